@@ -0,0 +1,3 @@
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Microbenchmarks for the scene_rdl2 binding layer (see benchmarks/run.py)."""
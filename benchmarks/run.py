@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Binding-layer microbenchmarks.
+
+Times the paths production scripts hit hardest — per-type ``obj[name]`` reads
+and writes, vector attribute conversion, ``getAllSceneObjects``,
+``AsciiReader.fromFile`` and ``BinaryWriter.toBytes`` — on synthetic scenes
+of each requested size, and writes the results as JSON.
+
+    python3 -m benchmarks.run --sizes 1k,100k --output results.json
+"""
+
+import argparse
+import json
+import os
+import platform
+import statistics
+import sys
+import tempfile
+import time
+
+from .scenes import rdl2, SyntheticScene, make_ctx, parse_size
+
+# Scalar and math types measured through __getitem__/__setitem__.
+ITEM_TYPES = [
+    rdl2.TYPE_BOOL, rdl2.TYPE_INT, rdl2.TYPE_FLOAT, rdl2.TYPE_STRING,
+    rdl2.TYPE_RGB, rdl2.TYPE_VEC3F, rdl2.TYPE_MAT4D, rdl2.TYPE_SCENE_OBJECT,
+]
+
+# Vector types measured with VECTOR_LENGTH elements per value.
+VECTOR_TYPES = [rdl2.TYPE_FLOAT_VECTOR, rdl2.TYPE_VEC3F_VECTOR]
+VECTOR_LENGTH = 10_000
+
+
+def _time(func, repeat):
+    """Return the wall-clock time of each of ``repeat`` calls to func()."""
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        times.append(time.perf_counter() - start)
+    return times
+
+
+class Suite:
+    def __init__(self, repeat):
+        self.repeat = repeat
+        self.results = []
+
+    def measure(self, name, size, items, func, **extra):
+        """Time func() and record it; ``items`` is the work per call, used for
+        the per-item cost."""
+        times = _time(func, self.repeat)
+        best = min(times)
+        result = {
+            "name": name,
+            "size": size,
+            "items": items,
+            "repeat": self.repeat,
+            "min_s": best,
+            "median_s": statistics.median(times),
+            "per_item_ns": best / items * 1e9 if items else None,
+        }
+        result.update(extra)
+        self.results.append(result)
+        print("%-40s %9d  %12.3f ms  %10.1f ns/item" %
+              (name, size, best * 1e3, result["per_item_ns"] or 0.0), file=sys.stderr)
+
+    # -----------------------------------------------------------------------
+    # Benchmarks
+    # -----------------------------------------------------------------------
+    def item_access(self, scene):
+        for attr_type in ITEM_TYPES:
+            attr, objects = scene.attribute_of_type(attr_type)
+            if attr is None:
+                continue
+            type_name = rdl2.attributeTypeName(attr_type)
+            values = [obj[attr] for obj in objects]
+
+            def get():
+                for obj in objects:
+                    obj[attr]
+
+            def set_():
+                for obj, value in zip(objects, values):
+                    obj[attr] = value
+
+            self.measure("getitem/" + type_name, scene.count, len(objects), get, attribute=attr)
+            self.measure("setitem/" + type_name, scene.count, len(objects), set_, attribute=attr)
+
+    def vector_conversion(self, scene):
+        for attr_type in VECTOR_TYPES:
+            attr, objects = scene.attribute_of_type(attr_type)
+            if attr is None:
+                continue
+            type_name = rdl2.attributeTypeName(attr_type)
+            obj = objects[0]
+            if attr_type == rdl2.TYPE_FLOAT_VECTOR:
+                obj[attr] = [float(i) for i in range(VECTOR_LENGTH)]
+            else:
+                obj[attr] = [rdl2.Vec3f(i, i, i) for i in range(VECTOR_LENGTH)]
+            value = obj[attr]
+
+            def set_():
+                obj[attr] = value
+
+            self.measure("vector_get/" + type_name, scene.count, VECTOR_LENGTH,
+                         lambda: obj[attr], attribute=attr)
+            self.measure("vector_set/" + type_name, scene.count, VECTOR_LENGTH,
+                         set_, attribute=attr)
+
+    def scene_queries(self, scene):
+        ctx = scene.ctx
+        objects = len(ctx.getAllSceneObjects())
+        self.measure("getAllSceneObjects", scene.count, objects, ctx.getAllSceneObjects)
+
+    def serialization(self, scene):
+        ctx = scene.ctx
+        objects = len(ctx.getAllSceneObjects())
+        self.measure("BinaryWriter.toBytes", scene.count, objects,
+                     rdl2.BinaryWriter(ctx).toBytes)
+
+        with tempfile.NamedTemporaryFile(suffix=".rdla", delete=False) as f:
+            path = f.name
+        try:
+            rdl2.AsciiWriter(ctx).toFile(path)
+            # Each read needs an empty context; build them outside the timing.
+            readers = [rdl2.AsciiReader(make_ctx()) for _ in range(self.repeat)]
+
+            def read():
+                readers.pop().fromFile(path)
+
+            self.measure("AsciiReader.fromFile", scene.count, objects, read,
+                         bytes=os.path.getsize(path))
+        finally:
+            os.unlink(path)
+
+    def run(self, size):
+        start = time.perf_counter()
+        scene = SyntheticScene(size)
+        print("built %d-object scene in %.1f s" % (size, time.perf_counter() - start),
+              file=sys.stderr)
+        self.item_access(scene)
+        self.vector_conversion(scene)
+        self.scene_queries(scene)
+        self.serialization(scene)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--sizes", default="1k,100k,1m",
+                        help="comma-separated scene sizes: 1k, 100k, 1m or an object count")
+    parser.add_argument("--repeat", type=int, default=5,
+                        help="timed runs per benchmark; the minimum is reported")
+    parser.add_argument("--output", help="write JSON results here instead of stdout")
+    args = parser.parse_args(argv)
+
+    suite = Suite(args.repeat)
+    for label in args.sizes.split(","):
+        suite.run(parse_size(label))
+
+    report = {
+        "module": rdl2.__file__,
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "results": suite.results,
+    }
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(report, f, indent=2)
+        print("wrote %s" % args.output, file=sys.stderr)
+    else:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+
+
+if __name__ == "__main__":
+    main()
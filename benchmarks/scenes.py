@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Synthetic scene generators for the benchmark suite."""
+
+import os
+import sys
+
+# ---------------------------------------------------------------------------
+# Path bootstrap — as in tests/helpers.py, fall back to build/ when the module
+# is not already importable (the CMake target sets PYTHONPATH).
+# ---------------------------------------------------------------------------
+_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+_BUILD = os.path.join(_ROOT, "build")
+if os.path.isdir(_BUILD):
+    sys.path.append(_BUILD)
+
+import scene_rdl2 as rdl2
+
+DSO_PATH = os.environ.get('RDL2_DSO_PATH')
+if not DSO_PATH:
+    sys.exit("Error: RDL2_DSO_PATH is not set. Source MoonRay's setup.sh before running.")
+
+# Size labels accepted on the command line.
+SIZES = {"1k": 1_000, "100k": 100_000, "1m": 1_000_000}
+
+
+def parse_size(label):
+    """Return the object count for a size label ('1k', '100k', '1m') or integer."""
+    label = label.strip().lower()
+    return SIZES[label] if label in SIZES else int(label)
+
+
+def make_ctx():
+    """Create a proxy-mode SceneContext with every DSO loaded."""
+    ctx = rdl2.SceneContext()
+    ctx.setProxyModeEnabled(True)
+    ctx.setDsoPath(DSO_PATH)
+    ctx.loadAllSceneClasses()
+    return ctx
+
+
+def _first_class_name(ctx, iface):
+    for sc in ctx.getAllSceneClasses():
+        if sc.getDeclaredInterface() & iface:
+            return sc.getName()
+    return None
+
+
+class SyntheticScene:
+    """A proxy-mode scene of ``count`` objects split evenly between a light,
+    a geometry and a material class, with every geometry in one GeometrySet.
+
+    ``objects_by_class`` maps each class name to its objects in creation
+    order, so benchmarks can pick homogeneous batches.
+    """
+
+    INTERFACES = (rdl2.INTERFACE_LIGHT, rdl2.INTERFACE_GEOMETRY, rdl2.INTERFACE_MATERIAL)
+
+    def __init__(self, count):
+        self.count = count
+        self.ctx = make_ctx()
+        names = [_first_class_name(self.ctx, iface) for iface in self.INTERFACES]
+        self.class_names = [n for n in names if n is not None]
+        if not self.class_names:
+            raise RuntimeError("no light, geometry or material DSOs found in RDL2_DSO_PATH")
+        self.objects_by_class = {name: [] for name in self.class_names}
+        create = self.ctx.createSceneObject
+        for i in range(count):
+            name = self.class_names[i % len(self.class_names)]
+            self.objects_by_class[name].append(create(name, "/bench/%s/%d" % (name, i)))
+
+        self.geometry_set = create("GeometrySet", "/bench/geometry_set")
+        geo_name = names[1]
+        if geo_name is not None:
+            with self.geometry_set.update():
+                for obj in self.objects_by_class[geo_name]:
+                    self.geometry_set.add(obj.asGeometry())
+
+    def attribute_of_type(self, attr_type):
+        """Return (attribute name, objects) for the first generated class with
+        an attribute of ``attr_type``, or (None, [])."""
+        for name in self.class_names:
+            for attr in self.ctx.getSceneClass(name).getAttributes():
+                if attr.getType() == attr_type:
+                    return attr.getName(), self.objects_by_class[name]
+        return None, []
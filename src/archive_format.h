@@ -0,0 +1,214 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Object-indexed RDL archive (".rdli").
+//
+// Unlike rdl2's binary (manifest, payload) encoding, which can only be decoded
+// whole, an archive stores each SceneObject as a separate record and ends with
+// an index, so single objects can be found and decoded without reading the
+// rest of the file:
+//
+//   offset  size  field
+//   0       4     magic "RDLI"
+//   4       4     version (uint32, currently 2)
+//   8       8     index offset (uint64)
+//   16      8     index entry count (uint64)
+//   24      ...   object records, back to back (see bind_archive.cpp)
+//   ...     ...   shared blobs, back to back
+//   index   ...   per record: object name, SceneClass name, record offset
+//                 (uint64) and record length (uint64); then the blob count
+//                 (uint64) and per blob: MurmurHash3 digest (2 x uint64),
+//                 offset (uint64) and length (uint64)
+//
+// A blob is the raw contents of a vector that records refer to by number
+// instead of storing it inline, so identical vectors are stored once.
+// Version 1 archives have no blobs and no blob count.
+//
+// Strings are a uint32 length followed by the bytes.  Header and index
+// integers are little-endian; attribute values inside records are stored in
+// the host's layout, so archives are only portable between little-endian hosts.
+
+#pragma once
+
+#include "murmur3.h"
+#include "stream_format.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr char     kArchiveMagic[4]   = {'R', 'D', 'L', 'I'};
+constexpr uint32_t kArchiveVersion    = 2;
+constexpr size_t   kArchiveHeaderSize = 24;
+
+struct ArchiveEntry
+{
+    std::string name;
+    std::string className;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+};
+
+struct ArchiveBlob
+{
+    Hash128 hash;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+};
+
+struct ArchiveIndex
+{
+    std::vector<ArchiveEntry> entries;
+    std::vector<ArchiveBlob> blobs;
+};
+
+// Appends little-endian integers, length-prefixed strings and raw bytes.
+class ByteWriter
+{
+public:
+    explicit ByteWriter(std::string& out) : mOut(out) {}
+
+    void putU8(uint8_t value) { mOut.push_back(static_cast<char>(value)); }
+    void putU32(uint32_t value) { putLE(value, 4); }
+    void putU64(uint64_t value) { putLE(value, 8); }
+
+    void putString(const std::string& s)
+    {
+        if (s.size() > UINT32_MAX)
+            throw std::length_error("string too long for an RDL archive");
+        putU32(static_cast<uint32_t>(s.size()));
+        mOut.append(s);
+    }
+
+    void putBytes(const void* data, size_t size)
+    {
+        mOut.append(static_cast<const char*>(data), size);
+    }
+
+private:
+    void putLE(uint64_t value, size_t bytes)
+    {
+        unsigned char buf[8];
+        frame_detail::putLE(buf, value, bytes);
+        mOut.append(reinterpret_cast<const char*>(buf), bytes);
+    }
+
+    std::string& mOut;
+};
+
+// Bounds-checked reader over [data, data + size).  Throws std::runtime_error
+// on reads past the end.
+class ByteReader
+{
+public:
+    ByteReader(const char* data, size_t size) : mPos(data), mEnd(data + size) {}
+
+    uint8_t getU8() { return static_cast<uint8_t>(*take(1)); }
+    uint32_t getU32() { return static_cast<uint32_t>(getLE(4)); }
+    uint64_t getU64() { return getLE(8); }
+
+    std::string getString()
+    {
+        const uint32_t size = getU32();
+        return std::string(take(size), size);
+    }
+
+    const char* getBytes(uint64_t size) { return take(size); }
+
+    bool atEnd() const { return mPos == mEnd; }
+
+private:
+    const char* take(uint64_t size)
+    {
+        if (size > static_cast<uint64_t>(mEnd - mPos))
+            throw std::runtime_error("corrupt RDL archive: record is truncated");
+        const char* at = mPos;
+        mPos += size;
+        return at;
+    }
+
+    uint64_t getLE(size_t bytes)
+    {
+        return frame_detail::getLE(reinterpret_cast<const unsigned char*>(take(bytes)), bytes);
+    }
+
+    const char* mPos;
+    const char* mEnd;
+};
+
+inline void encodeArchiveHeader(uint64_t indexOffset, uint64_t entryCount, std::string& out)
+{
+    ByteWriter writer(out);
+    writer.putBytes(kArchiveMagic, 4);
+    writer.putU32(kArchiveVersion);
+    writer.putU64(indexOffset);
+    writer.putU64(entryCount);
+}
+
+inline void encodeArchiveIndex(const ArchiveIndex& index, std::string& out)
+{
+    ByteWriter writer(out);
+    for (const ArchiveEntry& entry : index.entries) {
+        writer.putString(entry.name);
+        writer.putString(entry.className);
+        writer.putU64(entry.offset);
+        writer.putU64(entry.length);
+    }
+    writer.putU64(index.blobs.size());
+    for (const ArchiveBlob& blob : index.blobs) {
+        writer.putU64(blob.hash.h1);
+        writer.putU64(blob.hash.h2);
+        writer.putU64(blob.offset);
+        writer.putU64(blob.length);
+    }
+}
+
+// Parses the header and index of a whole archive file.  Throws
+// std::runtime_error if it is not an archive or is damaged.
+inline ArchiveIndex decodeArchiveIndex(const char* data, size_t size)
+{
+    if (size < kArchiveHeaderSize || std::memcmp(data, kArchiveMagic, 4) != 0)
+        throw std::runtime_error("not an RDL archive (bad magic)");
+    ByteReader header(data + 4, kArchiveHeaderSize - 4);
+    const uint32_t version = header.getU32();
+    if (version == 0 || version > kArchiveVersion)
+        throw std::runtime_error("unsupported RDL archive version " + std::to_string(version));
+    const uint64_t indexOffset = header.getU64();
+    const uint64_t count = header.getU64();
+    if (indexOffset < kArchiveHeaderSize || indexOffset > size)
+        throw std::runtime_error("corrupt RDL archive: bad index offset");
+
+    ByteReader in(data + indexOffset, size - indexOffset);
+    ArchiveIndex index;
+    for (uint64_t i = 0; i < count; ++i) {
+        ArchiveEntry entry;
+        entry.name = in.getString();
+        entry.className = in.getString();
+        entry.offset = in.getU64();
+        entry.length = in.getU64();
+        if (entry.offset < kArchiveHeaderSize || entry.offset > indexOffset ||
+            entry.length > indexOffset - entry.offset)
+            throw std::runtime_error("corrupt RDL archive: entry '" + entry.name +
+                                     "' lies outside the record area");
+        index.entries.push_back(std::move(entry));
+    }
+    if (version < 2)
+        return index;
+    const uint64_t blobCount = in.getU64();
+    for (uint64_t i = 0; i < blobCount; ++i) {
+        ArchiveBlob blob;
+        blob.hash.h1 = in.getU64();
+        blob.hash.h2 = in.getU64();
+        blob.offset = in.getU64();
+        blob.length = in.getU64();
+        if (blob.offset < kArchiveHeaderSize || blob.offset > indexOffset ||
+            blob.length > indexOffset - blob.offset)
+            throw std::runtime_error("corrupt RDL archive: blob " + std::to_string(i) +
+                                     " lies outside the data area");
+        index.blobs.push_back(blob);
+    }
+    return index;
+}
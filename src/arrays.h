@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// NumPy interop helpers shared by the bind_*.cpp files that move whole
+// rdl2 vectors (FloatVector, Vec3fVector, Mat4fVector, ...) across the
+// Python boundary without boxing each element.
+
+#pragma once
+
+#include "bindings.h"
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+// ---------------------------------------------------------------------------
+// ArrayTraits<T>: how an rdl2 element type maps onto an ndarray row.
+//   Scalar  — NumPy dtype of each component
+//   shape() — trailing dimensions of one element ({} for scalars)
+// IsArrayElement<T> is true_type exactly when ArrayTraits<T> is defined.
+// ---------------------------------------------------------------------------
+template <typename T> struct ArrayTraits;
+template <typename T> struct IsArrayElement : std::false_type {};
+
+// Number of scalar components in an element of the given shape.
+constexpr size_t componentCount(std::initializer_list<size_t> shape)
+{
+    size_t n = 1;
+    for (size_t d : shape)
+        n *= d;
+    return n;
+}
+
+#define DEFINE_ARRAY_TRAITS(T, S, ...)                                        \
+    template <> struct ArrayTraits<T> {                                       \
+        using Scalar = S;                                                     \
+        static std::vector<py::ssize_t> shape() { return {__VA_ARGS__}; }     \
+    };                                                                        \
+    template <> struct IsArrayElement<T> : std::true_type {};                 \
+    static_assert(sizeof(T) == sizeof(S) * componentCount({__VA_ARGS__}),    \
+                  #T " must be tightly packed for NumPy views");
+DEFINE_ARRAY_TRAITS(rdl2::Int,    rdl2::Int)
+DEFINE_ARRAY_TRAITS(rdl2::Long,   rdl2::Long)
+DEFINE_ARRAY_TRAITS(rdl2::Float,  rdl2::Float)
+DEFINE_ARRAY_TRAITS(rdl2::Double, rdl2::Double)
+DEFINE_ARRAY_TRAITS(rdl2::Rgb,    float,  3)
+DEFINE_ARRAY_TRAITS(rdl2::Rgba,   float,  4)
+DEFINE_ARRAY_TRAITS(rdl2::Vec2f,  float,  2)
+DEFINE_ARRAY_TRAITS(rdl2::Vec2d,  double, 2)
+DEFINE_ARRAY_TRAITS(rdl2::Vec3f,  float,  3)
+DEFINE_ARRAY_TRAITS(rdl2::Vec3d,  double, 3)
+DEFINE_ARRAY_TRAITS(rdl2::Vec4f,  float,  4)
+DEFINE_ARRAY_TRAITS(rdl2::Vec4d,  double, 4)
+DEFINE_ARRAY_TRAITS(rdl2::Mat4f,  float,  4, 4)
+DEFINE_ARRAY_TRAITS(rdl2::Mat4d,  double, 4, 4)
+#undef DEFINE_ARRAY_TRAITS
+
+// IsPackedVector<V>: true_type for std::vectors of ArrayTraits elements, whose
+// storage can be read or written as one block of memory.
+template <typename V> struct IsPackedVector : std::false_type {};
+template <typename E, typename A>
+struct IsPackedVector<std::vector<E, A>> : IsArrayElement<E> {};
+
+// Full ndarray shape for n elements of T, e.g. (n, 3) for Vec3f.
+template <typename T>
+std::vector<py::ssize_t> arrayShape(size_t n)
+{
+    std::vector<py::ssize_t> shape{static_cast<py::ssize_t>(n)};
+    for (py::ssize_t d : ArrayTraits<T>::shape())
+        shape.push_back(d);
+    return shape;
+}
+
+// C-contiguous strides matching arrayShape<T>().
+template <typename T>
+std::vector<py::ssize_t> arrayStrides()
+{
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    std::vector<py::ssize_t> inner = ArrayTraits<T>::shape();
+    std::vector<py::ssize_t> strides(inner.size() + 1);
+    py::ssize_t step = sizeof(Scalar);
+    for (size_t i = inner.size(); i-- > 0;) {
+        strides[i + 1] = step;
+        step *= inner[i];
+    }
+    strides[0] = sizeof(T);
+    return strides;
+}
+
+// Buffer-protocol description of a single math value, e.g. float[3] for
+// Vec3f or float[4][4] for Mat4f.  Used by the math types' def_buffer.
+template <typename T>
+py::buffer_info valueBuffer(T& value)
+{
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    std::vector<py::ssize_t> strides = arrayStrides<T>();
+    strides.erase(strides.begin());
+    return py::buffer_info(reinterpret_cast<Scalar*>(&value), sizeof(Scalar),
+                           py::format_descriptor<Scalar>::format(),
+                           static_cast<py::ssize_t>(strides.size()),
+                           ArrayTraits<T>::shape(), strides);
+}
+
+// Buffer-protocol description of a whole vector of math values, shaped like
+// arrayShape<T>().  Empty vectors still report a valid (non-null) pointer.
+template <typename V>
+py::buffer_info vectorBuffer(V& values)
+{
+    using T = typename V::value_type;
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    static Scalar sEmpty[1] = {};
+    Scalar* ptr = values.empty() ? sEmpty : reinterpret_cast<Scalar*>(values.data());
+    std::vector<py::ssize_t> shape = arrayShape<T>(values.size());
+    return py::buffer_info(ptr, sizeof(Scalar), py::format_descriptor<Scalar>::format(),
+                           static_cast<py::ssize_t>(shape.size()), shape, arrayStrides<T>());
+}
+
+// ---------------------------------------------------------------------------
+// MathArray<V>: Python-visible owner of an rdl2 vector of math values
+// (RgbArray, Vec3fArray, Mat4dArray, ...).  Bound in bind_math.cpp; accepted
+// by every setter that goes through vectorFromArray() without another copy.
+// ---------------------------------------------------------------------------
+template <typename V>
+struct MathArray
+{
+    V values;
+};
+
+// ---------------------------------------------------------------------------
+// arrayView: ndarray aliasing the storage of `values` (any contiguous rdl2
+// vector type).  `base` keeps the owner alive.  For views of attribute
+// storage the owner is the SceneObject wrapper, which does not own the
+// vector: such views are read-only, dangle once the attribute is next
+// modified, and are only handed out when the caller asks (copy=False).
+// ---------------------------------------------------------------------------
+template <typename V>
+py::array arrayView(const V& values, py::handle base, bool writable = false)
+{
+    using T = typename V::value_type;
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    if (values.empty())
+        return py::array_t<Scalar>(arrayShape<T>(0));
+    py::array view(py::dtype::of<Scalar>(), arrayShape<T>(values.size()),
+                   arrayStrides<T>(), values.data(), base);
+    if (!writable)
+        py::detail::array_proxy(view.ptr())->flags &=
+            ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return view;
+}
+
+// arrayCopy: freshly allocated ndarray holding a copy of `values`.
+template <typename V>
+py::array arrayCopy(const V& values)
+{
+    using T = typename V::value_type;
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    py::array_t<Scalar> result(arrayShape<T>(values.size()));
+    if (!values.empty())
+        std::memcpy(result.mutable_data(), values.data(), values.size() * sizeof(T));
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// vectorFromArray: convert any array-like (ndarray, buffer, nested sequence,
+// MathArray) into an rdl2 vector type V with one memcpy.  Non-contiguous or
+// differently typed input is converted by NumPy first (forcecast).
+// ---------------------------------------------------------------------------
+template <typename V>
+V vectorFromArray(py::handle obj)
+{
+    using T = typename V::value_type;
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    if (py::isinstance<MathArray<V>>(obj))
+        return obj.cast<const MathArray<V>&>().values;
+
+    auto arr = py::array_t<Scalar, py::array::c_style | py::array::forcecast>::ensure(obj);
+    if (!arr)
+        throw py::type_error("expected an array-like of numbers");
+
+    const std::vector<py::ssize_t> inner = ArrayTraits<T>::shape();
+    bool ok = static_cast<size_t>(arr.ndim()) == inner.size() + 1;
+    for (size_t i = 0; ok && i < inner.size(); ++i)
+        ok = arr.shape(i + 1) == inner[i];
+    if (!ok) {
+        std::string expected = "(N";
+        for (py::ssize_t d : inner)
+            expected += ", " + std::to_string(d);
+        throw py::value_error("expected an array of shape " + expected + ")");
+    }
+
+    V result(static_cast<size_t>(arr.shape(0)));
+    if (!result.empty())
+        std::memcpy(result.data(), arr.data(), result.size() * sizeof(T));
+    return result;
+}
+
+// valueFromArray: a single math value from an array-like of exactly its
+// shape.  A 0-d array (e.g. a NumPy scalar) fills every component, like the
+// math types' single-scalar constructors.
+template <typename T>
+T valueFromArray(py::handle obj)
+{
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    auto arr = py::array_t<Scalar, py::array::c_style | py::array::forcecast>::ensure(obj);
+    if (!arr)
+        throw py::type_error("expected an array-like of numbers");
+    T result;
+    if (arr.ndim() == 0) {
+        Scalar* out = reinterpret_cast<Scalar*>(&result);
+        std::fill(out, out + sizeof(T) / sizeof(Scalar), *arr.data());
+        return result;
+    }
+    const std::vector<py::ssize_t> inner = ArrayTraits<T>::shape();
+    if (arr.ndim() != static_cast<py::ssize_t>(inner.size()) ||
+        !std::equal(inner.begin(), inner.end(), arr.shape()))
+        throw py::value_error("array has the wrong shape for this type");
+    std::memcpy(&result, arr.data(), sizeof(T));
+    return result;
+}
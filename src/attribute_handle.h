@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// AttributeHandle: one SceneClass attribute, resolved once.
+//
+// A handle holds the typed rdl2::AttributeKey<T> for its attribute together
+// with the Python <-> C++ converters for T, so get()/set() do no name lookup
+// and no switch on AttributeType.  Handles are only valid for objects of the
+// SceneClass they were created from.
+
+#pragma once
+
+#include "bindings.h"
+
+#include <memory>
+#include <vector>
+
+class AttributeHandle
+{
+public:
+    virtual ~AttributeHandle() = default;
+
+    const rdl2::SceneClass& getSceneClass() const { return *mSceneClass; }
+    const rdl2::Attribute&  getAttribute()  const { return *mAttribute; }
+
+    // Throws TypeError unless `obj` is an instance of this handle's SceneClass.
+    void checkObject(const rdl2::SceneObject& obj) const
+    {
+        if (&obj.getSceneClass() != mSceneClass)
+            throw py::type_error("AttributeHandle for '" + mSceneClass->getName() + "." +
+                                 mAttribute->getName() + "' used with object '" +
+                                 obj.getName() + "' of class '" +
+                                 obj.getSceneClass().getName() + "'");
+    }
+
+    // Unchecked accessors: the caller has verified the SceneClass.  set()
+    // requires the caller to hold an UpdateScope on `obj`.
+    virtual py::object get(const rdl2::SceneObject& obj, rdl2::AttributeTimestep ts) const = 0;
+    virtual void set(rdl2::SceneObject& obj, py::handle value, rdl2::AttributeTimestep ts) const = 0;
+
+    // Batch access behind SceneContext.getMany/setMany.  handles[i] is the
+    // handle for objs[i] (see resolveAttributeHandles) and shares this
+    // handle's type.  The per-object loop runs with the GIL released;
+    // setMany() takes an UpdateScope on each object itself.
+    virtual py::object getMany(const std::vector<rdl2::SceneObject*>& objs,
+                               const std::vector<const AttributeHandle*>& handles,
+                               rdl2::AttributeTimestep ts) const = 0;
+    virtual void setMany(const std::vector<rdl2::SceneObject*>& objs,
+                         const std::vector<const AttributeHandle*>& handles,
+                         py::handle values, rdl2::AttributeTimestep ts) const = 0;
+
+protected:
+    AttributeHandle(const rdl2::SceneClass& sc, const rdl2::Attribute& attr)
+        : mSceneClass(&sc), mAttribute(&attr) {}
+
+    const rdl2::SceneClass* mSceneClass;
+    const rdl2::Attribute*  mAttribute;
+};
+
+using AttributeHandlePtr = std::shared_ptr<AttributeHandle>;
+
+// Returns the handle for `sc`.`name`, creating and caching it on first use.
+// Throws if the SceneClass has no such attribute.  Requires the GIL.
+const AttributeHandlePtr& getAttributeHandle(const rdl2::SceneClass& sc, const std::string& name);
+
+// Returns the handle for attribute `name` of each object in `objs`, resolving
+// it once per SceneClass.  Throws TypeError for None entries or if the
+// attribute's type differs between the objects' classes.  Requires the GIL.
+std::vector<const AttributeHandle*> resolveAttributeHandles(
+    const std::vector<rdl2::SceneObject*>& objs, const std::string& name);
@@ -0,0 +1,600 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Object-indexed archives (archive_format.h): BinaryWriter.writeIndexedFile,
+// BinaryReader.readIndex and BinaryReader.readObjects.
+//
+// Each record holds one SceneObject's attributes, in its SceneClass's
+// declaration order:
+//
+//   uint32 attribute count
+//   per attribute:
+//     string name, uint8 AttributeType, uint8 flags
+//       (1: a TIMESTEP_END value follows, 2: a binding follows)
+//     value at TIMESTEP_BEGIN, [value at TIMESTEP_END], [binding]
+//
+// Values: Bool is one byte; numbers and math types are their raw bytes; a
+// String is a uint64 length and its bytes; a SceneObject reference is its
+// class name and object name as strings (empty class name for null).
+// Vectors are a uint8 storage tag and a uint64 element count, followed by
+//   0 (inline): the elements, with numeric and math vectors as one block;
+//   1 (blob):   a uint64 blob number (numeric and math vectors only).
+//
+// Objects are encoded in parallel with TBB and written in name order.  When
+// deduplication is on, numeric vectors above a size threshold are hashed
+// while encoding and each distinct one is written once as a blob.
+// Decoding creates any referenced objects that the context does not already
+// have, with default values, as rdl2's own readers do.
+
+#include "bindings.h"
+#include "archive_format.h"
+#include "arrays.h"
+#include "mapped_file.h"
+#include "murmur3.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+enum : uint8_t
+{
+    kHasEndValue = 1,
+    kHasBinding  = 2,
+};
+
+enum : uint8_t
+{
+    kStorageInline = 0,
+    kStorageBlob   = 1,
+};
+
+template <typename V>
+using ElementOf = typename std::decay<decltype(*std::declval<const V&>().begin())>::type;
+
+// ---------------------------------------------------------------------------
+// Encoding
+// ---------------------------------------------------------------------------
+
+// A vector that an encoded record stores as a blob.  Its blob number is not
+// known until every record has been encoded, so `patchAt` is where in the
+// record to write it.
+struct BlobUse
+{
+    Hash128 hash;
+    const char* data;
+    uint64_t size;
+    size_t patchAt;
+};
+
+class RecordEncoder
+{
+public:
+    // Numeric vectors of at least `minBlobBytes` are stored as blobs and
+    // listed in `blobs`; with no `blobs`, every vector is stored inline.
+    explicit RecordEncoder(std::string& out, uint64_t minBlobBytes = 0,
+                           std::vector<BlobUse>* blobs = nullptr)
+        : mRecord(out), mOut(out), mMinBlobBytes(minBlobBytes), mBlobs(blobs) {}
+
+    void encode(const rdl2::SceneObject& obj)
+    {
+        const rdl2::SceneClass& sc = obj.getSceneClass();
+        mOut.putU32(static_cast<uint32_t>(std::distance(sc.beginAttributes(), sc.endAttributes())));
+        for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it) {
+            const rdl2::Attribute& attr = **it;
+            mOut.putString(attr.getName());
+            mOut.putU8(static_cast<uint8_t>(attr.getType()));
+            mOut.putU8(static_cast<uint8_t>((attr.isBlurrable() ? kHasEndValue : 0) |
+                                            (attr.isBindable() ? kHasBinding : 0)));
+            putAttribute(obj, attr);
+            if (attr.isBindable())
+                putRef(obj.getBinding(attr));
+        }
+    }
+
+private:
+    void putRef(const rdl2::SceneObject* obj)
+    {
+        mOut.putString(obj ? obj->getSceneClass().getName() : std::string());
+        if (obj)
+            mOut.putString(obj->getName());
+    }
+
+    template <typename T>
+    void putValue(const T& value)
+    {
+        static_assert(IsArrayElement<T>::value, "no archive encoding for this type");
+        mOut.putBytes(&value, sizeof(T));
+    }
+    void putValue(bool value) { mOut.putU8(value); }
+    void putValue(const std::string& value)
+    {
+        mOut.putU64(value.size());
+        mOut.putBytes(value.data(), value.size());
+    }
+    void putValue(rdl2::SceneObject* value) { putRef(value); }
+
+    template <typename V>
+    void putElements(const V& values, std::true_type /*packed*/)
+    {
+        mOut.putBytes(values.data(), values.size() * sizeof(ElementOf<V>));
+    }
+
+    template <typename V>
+    void putElements(const V& values, std::false_type)
+    {
+        for (const auto& value : values)
+            putValue(value);
+    }
+
+    template <typename T>
+    void putScalar(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+        const rdl2::AttributeKey<T> key(attr);
+        putValue(obj.get(key, rdl2::TIMESTEP_BEGIN));
+        if (attr.isBlurrable())
+            putValue(obj.get(key, rdl2::TIMESTEP_END));
+    }
+
+    template <typename V>
+    void putVector(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+        const V& values = obj.get(rdl2::AttributeKey<V>(attr));
+        const uint64_t count = static_cast<uint64_t>(std::distance(values.begin(), values.end()));
+        if (putBlob(values, count, IsPackedVector<V>()))
+            return;
+        mOut.putU8(kStorageInline);
+        mOut.putU64(count);
+        putElements(values, IsPackedVector<V>());
+    }
+
+    template <typename V>
+    bool putBlob(const V& values, uint64_t count, std::true_type /*packed*/)
+    {
+        const uint64_t size = count * sizeof(ElementOf<V>);
+        if (!mBlobs || size == 0 || size < mMinBlobBytes)
+            return false;
+        Murmur3Hasher hasher;
+        hasher.update(values.data(), size);
+        mOut.putU8(kStorageBlob);
+        mOut.putU64(count);
+        mBlobs->push_back({hasher.digest(), reinterpret_cast<const char*>(values.data()), size,
+                           mRecord.size()});
+        mOut.putU64(0);
+        return true;
+    }
+
+    template <typename V>
+    bool putBlob(const V&, uint64_t, std::false_type)
+    {
+        return false;
+    }
+
+    void putAttribute(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+#define SCALAR(TYPE, T) case rdl2::TYPE: putScalar<T>(obj, attr); break;
+#define VECTOR(TYPE, V) case rdl2::TYPE: putVector<V>(obj, attr); break;
+        switch (attr.getType()) {
+            SCALAR(TYPE_BOOL,   rdl2::Bool)
+            SCALAR(TYPE_INT,    rdl2::Int)
+            SCALAR(TYPE_LONG,   rdl2::Long)
+            SCALAR(TYPE_FLOAT,  rdl2::Float)
+            SCALAR(TYPE_DOUBLE, rdl2::Double)
+            SCALAR(TYPE_STRING, rdl2::String)
+            SCALAR(TYPE_RGB,    rdl2::Rgb)
+            SCALAR(TYPE_RGBA,   rdl2::Rgba)
+            SCALAR(TYPE_VEC2F,  rdl2::Vec2f)
+            SCALAR(TYPE_VEC2D,  rdl2::Vec2d)
+            SCALAR(TYPE_VEC3F,  rdl2::Vec3f)
+            SCALAR(TYPE_VEC3D,  rdl2::Vec3d)
+            SCALAR(TYPE_VEC4F,  rdl2::Vec4f)
+            SCALAR(TYPE_VEC4D,  rdl2::Vec4d)
+            SCALAR(TYPE_MAT4F,  rdl2::Mat4f)
+            SCALAR(TYPE_MAT4D,  rdl2::Mat4d)
+            SCALAR(TYPE_SCENE_OBJECT, rdl2::SceneObject*)
+            VECTOR(TYPE_BOOL_VECTOR,   rdl2::BoolVector)
+            VECTOR(TYPE_INT_VECTOR,    rdl2::IntVector)
+            VECTOR(TYPE_LONG_VECTOR,   rdl2::LongVector)
+            VECTOR(TYPE_FLOAT_VECTOR,  rdl2::FloatVector)
+            VECTOR(TYPE_DOUBLE_VECTOR, rdl2::DoubleVector)
+            VECTOR(TYPE_STRING_VECTOR, rdl2::StringVector)
+            VECTOR(TYPE_RGB_VECTOR,    rdl2::RgbVector)
+            VECTOR(TYPE_RGBA_VECTOR,   rdl2::RgbaVector)
+            VECTOR(TYPE_VEC2F_VECTOR,  rdl2::Vec2fVector)
+            VECTOR(TYPE_VEC2D_VECTOR,  rdl2::Vec2dVector)
+            VECTOR(TYPE_VEC3F_VECTOR,  rdl2::Vec3fVector)
+            VECTOR(TYPE_VEC3D_VECTOR,  rdl2::Vec3dVector)
+            VECTOR(TYPE_VEC4F_VECTOR,  rdl2::Vec4fVector)
+            VECTOR(TYPE_VEC4D_VECTOR,  rdl2::Vec4dVector)
+            VECTOR(TYPE_MAT4F_VECTOR,  rdl2::Mat4fVector)
+            VECTOR(TYPE_MAT4D_VECTOR,  rdl2::Mat4dVector)
+            VECTOR(TYPE_SCENE_OBJECT_VECTOR,    rdl2::SceneObjectVector)
+            VECTOR(TYPE_SCENE_OBJECT_INDEXABLE, rdl2::SceneObjectIndexable)
+            default:
+                throw std::runtime_error("cannot archive attribute '" + attr.getName() +
+                                         "' of type " + rdl2::attributeTypeName(attr.getType()));
+        }
+#undef SCALAR
+#undef VECTOR
+    }
+
+    std::string& mRecord;
+    ByteWriter mOut;
+    uint64_t mMinBlobBytes;
+    std::vector<BlobUse>* mBlobs;
+};
+
+// Numbers the distinct blobs used by `records`, in record order, laying them
+// out from `offset` on, and writes each use's blob number into its record.
+// Returns the data of each blob.  Equal hashes are confirmed by comparing
+// bytes; a vector whose hash collides with a different one gets its own blob.
+static std::vector<const char*> assignBlobs(std::vector<std::string>& records,
+                                            const std::vector<std::vector<BlobUse>>& uses,
+                                            uint64_t offset, std::vector<ArchiveBlob>& blobs)
+{
+    std::vector<const char*> data;
+    std::map<Hash128, size_t> byHash;
+    for (size_t i = 0; i < records.size(); ++i) {
+        for (const BlobUse& use : uses[i]) {
+            auto found = byHash.find(use.hash);
+            size_t number;
+            if (found != byHash.end() && blobs[found->second].length == use.size &&
+                std::memcmp(data[found->second], use.data, use.size) == 0) {
+                number = found->second;
+            } else {
+                number = blobs.size();
+                blobs.push_back({use.hash, offset, use.size});
+                data.push_back(use.data);
+                byHash.emplace(use.hash, number);
+                offset += use.size;
+            }
+            frame_detail::putLE(reinterpret_cast<unsigned char*>(&records[i][use.patchAt]),
+                                number, 8);
+        }
+    }
+    return data;
+}
+
+void writeIndexedFile(const rdl2::SceneContext& ctx, const std::string& filename,
+                      uint64_t dedupMinBytes)
+{
+    std::vector<const rdl2::SceneObject*> objects;
+    for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+        objects.push_back(it->second);
+    std::sort(objects.begin(), objects.end(),
+              [](const rdl2::SceneObject* a, const rdl2::SceneObject* b) {
+                  return a->getName() < b->getName();
+              });
+
+    std::vector<std::string> records(objects.size());
+    std::vector<std::vector<BlobUse>> uses(objects.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, objects.size(), 64),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i)
+                RecordEncoder(records[i], dedupMinBytes, dedupMinBytes ? &uses[i] : nullptr)
+                    .encode(*objects[i]);
+        });
+
+    ArchiveIndex archive;
+    archive.entries.resize(objects.size());
+    uint64_t offset = kArchiveHeaderSize;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        ArchiveEntry& entry = archive.entries[i];
+        entry.name = objects[i]->getName();
+        entry.className = objects[i]->getSceneClass().getName();
+        entry.offset = offset;
+        entry.length = records[i].size();
+        offset += records[i].size();
+    }
+    const std::vector<const char*> blobData = assignBlobs(records, uses, offset, archive.blobs);
+    for (const ArchiveBlob& blob : archive.blobs)
+        offset += blob.length;
+
+    std::string header, index;
+    encodeArchiveHeader(offset, archive.entries.size(), header);
+    encodeArchiveIndex(archive, index);
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)  // iostreams do not report why, and need not set errno
+        throw std::runtime_error("cannot open '" + filename + "' for writing");
+    out.write(header.data(), header.size());
+    for (const std::string& record : records)
+        out.write(record.data(), record.size());
+    for (size_t i = 0; i < blobData.size(); ++i)
+        out.write(blobData[i], archive.blobs[i].length);
+    out.write(index.data(), index.size());
+    out.close();
+    if (!out)
+        throw std::runtime_error("failed writing RDL archive '" + filename + "'");
+}
+
+// ---------------------------------------------------------------------------
+// Decoding
+// ---------------------------------------------------------------------------
+class RecordDecoder
+{
+public:
+    // Names of referenced objects are appended to `refs`.  Blob numbers are
+    // resolved through `blobs`, whose offsets are relative to `file`.
+    RecordDecoder(rdl2::SceneContext& ctx, ByteReader& in, std::vector<std::string>& refs,
+                  const char* file, const std::vector<ArchiveBlob>& blobs)
+        : mCtx(ctx), mIn(in), mRefs(refs), mFile(file), mBlobs(blobs) {}
+
+    void decode(rdl2::SceneObject& obj)
+    {
+        const rdl2::SceneClass& sc = obj.getSceneClass();
+        std::unordered_map<std::string, const rdl2::Attribute*> attrs;
+        for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it)
+            attrs.emplace((*it)->getName(), *it);
+
+        // A plain begin/endUpdate, as in rdl2's own readers: loads are not
+        // reported to ChangeTrackers.
+        rdl2::SceneObject::UpdateGuard guard(&obj);
+        const uint32_t count = mIn.getU32();
+        for (uint32_t i = 0; i < count; ++i) {
+            const std::string name = mIn.getString();
+            const auto type = static_cast<rdl2::AttributeType>(mIn.getU8());
+            const uint8_t flags = mIn.getU8();
+            // Attributes the class no longer declares, or has retyped, are
+            // read and dropped.
+            auto found = attrs.find(name);
+            const rdl2::Attribute* attr =
+                found != attrs.end() && found->second->getType() == type ? found->second : nullptr;
+            mApply = attr != nullptr;
+            getAttribute(obj, attr, type, flags & kHasEndValue);
+            if (flags & kHasBinding) {
+                rdl2::SceneObject* target = getRef();
+                if (attr && attr->isBindable())
+                    obj.setBinding(name, target);
+            }
+        }
+        if (!mIn.atEnd())
+            throw std::runtime_error("corrupt RDL archive: trailing bytes in record for '" +
+                                     obj.getName() + "'");
+    }
+
+private:
+    rdl2::SceneObject* getRef()
+    {
+        const std::string className = mIn.getString();
+        if (className.empty())
+            return nullptr;
+        const std::string name = mIn.getString();
+        if (!mApply)
+            return nullptr;
+        mRefs.push_back(name);
+        return mCtx.createSceneObject(className, name);
+    }
+
+    template <typename T>
+    void getValue(T& value)
+    {
+        static_assert(IsArrayElement<T>::value, "no archive encoding for this type");
+        std::memcpy(&value, mIn.getBytes(sizeof(T)), sizeof(T));
+    }
+    void getValue(bool& value) { value = mIn.getU8() != 0; }
+    void getValue(std::string& value)
+    {
+        const uint64_t size = mIn.getU64();
+        value.assign(mIn.getBytes(size), size);
+    }
+    void getValue(rdl2::SceneObject*& value) { value = getRef(); }
+
+    template <typename E>
+    void getElements(std::vector<E>& values, uint64_t count, std::true_type /*packed*/)
+    {
+        const char* data = mIn.getBytes(count * sizeof(E));
+        values.resize(count);
+        std::memcpy(values.data(), data, count * sizeof(E));
+    }
+
+    template <typename E>
+    void getElements(std::vector<E>& values, uint64_t count, std::false_type)
+    {
+        for (uint64_t i = 0; i < count; ++i) {
+            E value{};
+            getValue(value);
+            values.push_back(value);
+        }
+    }
+
+    // rdl2 gives every attribute its own vector storage, so a blob shared by
+    // several objects is still copied into each; it is only paged in once.
+    template <typename E>
+    void getBlob(std::vector<E>& values, uint64_t count, std::true_type /*packed*/)
+    {
+        const uint64_t number = mIn.getU64();
+        if (number >= mBlobs.size())
+            throw std::runtime_error("corrupt RDL archive: unknown blob " + std::to_string(number));
+        const ArchiveBlob& blob = mBlobs[number];
+        if (blob.length % sizeof(E) != 0 || blob.length / sizeof(E) != count)
+            throw std::runtime_error("corrupt RDL archive: blob " + std::to_string(number) +
+                                     " does not match its vector");
+        values.resize(count);
+        std::memcpy(values.data(), mFile + blob.offset, blob.length);
+    }
+
+    template <typename E>
+    void getBlob(std::vector<E>&, uint64_t, std::false_type)
+    {
+        throw std::runtime_error("corrupt RDL archive: blob storage for a non-numeric vector");
+    }
+
+    template <typename T>
+    void getScalar(rdl2::SceneObject& obj, const rdl2::Attribute* attr, bool hasEnd)
+    {
+        T value{};
+        getValue(value);
+        if (attr)
+            obj.set(rdl2::AttributeKey<T>(*attr), value, rdl2::TIMESTEP_BEGIN);
+        if (!hasEnd)
+            return;
+        getValue(value);
+        if (attr && attr->isBlurrable())
+            obj.set(rdl2::AttributeKey<T>(*attr), value, rdl2::TIMESTEP_END);
+    }
+
+    template <typename V>
+    void getVector(rdl2::SceneObject& obj, const rdl2::Attribute* attr)
+    {
+        using E = ElementOf<V>;
+        using Packed = std::integral_constant<bool, IsArrayElement<E>::value>;
+        const uint8_t storage = mIn.getU8();
+        if (storage != kStorageInline && storage != kStorageBlob)
+            throw std::runtime_error("corrupt RDL archive: unknown vector storage " +
+                                     std::to_string(storage));
+        const uint64_t count = mIn.getU64();
+        std::vector<E> values;
+        if (storage == kStorageBlob)
+            getBlob(values, count, Packed());
+        else
+            getElements(values, count, Packed());
+        if (attr)
+            obj.set(rdl2::AttributeKey<V>(*attr),
+                    toVector<V>(std::move(values), std::is_same<V, std::vector<E>>()));
+    }
+
+    template <typename V, typename E>
+    static V toVector(std::vector<E>&& values, std::true_type /*same type*/)
+    {
+        return std::move(values);
+    }
+
+    template <typename V, typename E>
+    static V toVector(std::vector<E>&& values, std::false_type)
+    {
+        return V(values.begin(), values.end());
+    }
+
+    void getAttribute(rdl2::SceneObject& obj, const rdl2::Attribute* attr,
+                      rdl2::AttributeType type, bool hasEnd)
+    {
+#define SCALAR(TYPE, T) case rdl2::TYPE: getScalar<T>(obj, attr, hasEnd); break;
+#define VECTOR(TYPE, V) case rdl2::TYPE: getVector<V>(obj, attr); break;
+        switch (type) {
+            SCALAR(TYPE_BOOL,   rdl2::Bool)
+            SCALAR(TYPE_INT,    rdl2::Int)
+            SCALAR(TYPE_LONG,   rdl2::Long)
+            SCALAR(TYPE_FLOAT,  rdl2::Float)
+            SCALAR(TYPE_DOUBLE, rdl2::Double)
+            SCALAR(TYPE_STRING, rdl2::String)
+            SCALAR(TYPE_RGB,    rdl2::Rgb)
+            SCALAR(TYPE_RGBA,   rdl2::Rgba)
+            SCALAR(TYPE_VEC2F,  rdl2::Vec2f)
+            SCALAR(TYPE_VEC2D,  rdl2::Vec2d)
+            SCALAR(TYPE_VEC3F,  rdl2::Vec3f)
+            SCALAR(TYPE_VEC3D,  rdl2::Vec3d)
+            SCALAR(TYPE_VEC4F,  rdl2::Vec4f)
+            SCALAR(TYPE_VEC4D,  rdl2::Vec4d)
+            SCALAR(TYPE_MAT4F,  rdl2::Mat4f)
+            SCALAR(TYPE_MAT4D,  rdl2::Mat4d)
+            SCALAR(TYPE_SCENE_OBJECT, rdl2::SceneObject*)
+            VECTOR(TYPE_BOOL_VECTOR,   rdl2::BoolVector)
+            VECTOR(TYPE_INT_VECTOR,    rdl2::IntVector)
+            VECTOR(TYPE_LONG_VECTOR,   rdl2::LongVector)
+            VECTOR(TYPE_FLOAT_VECTOR,  rdl2::FloatVector)
+            VECTOR(TYPE_DOUBLE_VECTOR, rdl2::DoubleVector)
+            VECTOR(TYPE_STRING_VECTOR, rdl2::StringVector)
+            VECTOR(TYPE_RGB_VECTOR,    rdl2::RgbVector)
+            VECTOR(TYPE_RGBA_VECTOR,   rdl2::RgbaVector)
+            VECTOR(TYPE_VEC2F_VECTOR,  rdl2::Vec2fVector)
+            VECTOR(TYPE_VEC2D_VECTOR,  rdl2::Vec2dVector)
+            VECTOR(TYPE_VEC3F_VECTOR,  rdl2::Vec3fVector)
+            VECTOR(TYPE_VEC3D_VECTOR,  rdl2::Vec3dVector)
+            VECTOR(TYPE_VEC4F_VECTOR,  rdl2::Vec4fVector)
+            VECTOR(TYPE_VEC4D_VECTOR,  rdl2::Vec4dVector)
+            VECTOR(TYPE_MAT4F_VECTOR,  rdl2::Mat4fVector)
+            VECTOR(TYPE_MAT4D_VECTOR,  rdl2::Mat4dVector)
+            VECTOR(TYPE_SCENE_OBJECT_VECTOR,    rdl2::SceneObjectVector)
+            VECTOR(TYPE_SCENE_OBJECT_INDEXABLE, rdl2::SceneObjectIndexable)
+            default:
+                throw std::runtime_error("corrupt RDL archive: unknown attribute type " +
+                                         std::to_string(static_cast<int>(type)));
+        }
+#undef SCALAR
+#undef VECTOR
+    }
+
+    rdl2::SceneContext& mCtx;
+    ByteReader& mIn;
+    std::vector<std::string>& mRefs;
+    const char* mFile;
+    const std::vector<ArchiveBlob>& mBlobs;
+    bool mApply = true;
+};
+
+py::list readIndex(const std::string& filename)
+{
+    std::vector<ArchiveEntry> entries;
+    {
+        py::gil_scoped_release release;
+        MappedFile file(filename);
+        entries = decodeArchiveIndex(file.data(), file.size()).entries;
+    }
+    py::list result;
+    for (ArchiveEntry& entry : entries)
+        result.append(py::cast(std::move(entry)));
+    return result;
+}
+
+size_t readObjects(rdl2::SceneContext& ctx, const std::string& filename,
+                   const std::vector<std::string>& names, bool withReferences)
+{
+    MappedFile file(filename);
+    const ArchiveIndex index = decodeArchiveIndex(file.data(), file.size());
+    std::unordered_map<std::string, const ArchiveEntry*> byName;
+    for (const ArchiveEntry& entry : index.entries)
+        byName.emplace(entry.name, &entry);
+
+    for (const std::string& name : names)
+        if (!byName.count(name))
+            throw py::key_error("'" + name + "' is not in RDL archive '" + filename + "'");
+
+    // Depth-first, so each requested object is followed by what it references.
+    std::vector<std::string> pending(names.rbegin(), names.rend());
+    std::unordered_set<std::string> visited;
+    std::vector<std::string> refs;
+    size_t decoded = 0;
+    while (!pending.empty()) {
+        const std::string name = std::move(pending.back());
+        pending.pop_back();
+        auto found = byName.find(name);
+        if (!visited.insert(name).second || found == byName.end())
+            continue;
+        const ArchiveEntry& entry = *found->second;
+        rdl2::SceneObject* obj = ctx.createSceneObject(entry.className, entry.name);
+        ByteReader in(file.data() + entry.offset, entry.length);
+        refs.clear();
+        RecordDecoder(ctx, in, refs, file.data(), index.blobs).decode(*obj);
+        if (withReferences)
+            pending.insert(pending.end(), refs.rbegin(), refs.rend());
+        ++decoded;
+    }
+    return decoded;
+}
+
+// ---------------------------------------------------------------------------
+// bind_archive
+// ---------------------------------------------------------------------------
+void bind_archive(py::module_& m)
+{
+    py::class_<ArchiveEntry>(m, "ArchiveEntry",
+        "One object record in an RDL archive (see BinaryReader.readIndex).")
+        .def_readonly("name", &ArchiveEntry::name)
+        .def_readonly("className", &ArchiveEntry::className)
+        .def_readonly("offset", &ArchiveEntry::offset,
+                      "Byte offset of the record within the file.")
+        .def_readonly("length", &ArchiveEntry::length,
+                      "Record size in bytes.")
+        .def("__repr__", [](const ArchiveEntry& self) {
+            return "<ArchiveEntry '" + self.name + "' (" + self.className + ") " +
+                   std::to_string(self.length) + " bytes at " + std::to_string(self.offset) + ">";
+        });
+}
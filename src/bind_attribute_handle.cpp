@@ -0,0 +1,418 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// AttributeHandle implementation and its Python binding.  SceneObject's
+// __getitem__/__setitem__ also go through these handles.
+
+#include "attribute_handle.h"
+#include "arrays.h"
+#include "update_scope.h"
+
+#include <unordered_map>
+
+// ---------------------------------------------------------------------------
+// AttributeOps<T>: raw access and Python conversion for one attribute value
+// type.
+//   read/write          — typed get/set on a SceneObject (no Python)
+//   toPython/fromPython — conversion of a single value
+// ---------------------------------------------------------------------------
+template <typename T>
+struct ValueOps
+{
+    using Type = T;
+    static const T& read(const rdl2::SceneObject& obj, rdl2::AttributeKey<T> key,
+                         rdl2::AttributeTimestep ts)
+    {
+        return obj.get(key, ts);
+    }
+    static void write(rdl2::SceneObject& obj, rdl2::AttributeKey<T> key, const T& value,
+                      rdl2::AttributeTimestep ts)
+    {
+        obj.set(key, value, ts);
+    }
+    static py::object toPython(const T& value) { return py::cast(value); }
+    static T fromPython(py::handle value) { return value.cast<T>(); }
+};
+
+// Vector attributes are not blurrable; they are read at TIMESTEP_BEGIN.
+template <typename V>
+struct VectorOps : ValueOps<V>
+{
+    static const V& read(const rdl2::SceneObject& obj, rdl2::AttributeKey<V> key,
+                         rdl2::AttributeTimestep)
+    {
+        return obj.get(key);
+    }
+};
+
+// Numeric vectors additionally take ndarrays/MathArrays with one memcpy.
+template <typename V>
+struct ArrayOps : VectorOps<V>
+{
+    static V fromPython(py::handle value)
+    {
+        if (py::isinstance<py::buffer>(value))
+            return vectorFromArray<V>(value);
+        return value.cast<V>();
+    }
+};
+
+// Math values additionally take ndarrays and other buffers of their shape.
+// This is explicit here rather than a py::implicitly_convertible, so only
+// attribute assignment accepts arbitrary buffers.
+template <typename T>
+struct MathOps : ValueOps<T>
+{
+    static T fromPython(py::handle value)
+    {
+        if (!py::isinstance<T>(value) && py::isinstance<py::buffer>(value))
+            return valueFromArray<T>(value);
+        return value.cast<T>();
+    }
+};
+
+template <typename T> struct AttributeOps : ValueOps<T> {};
+template <> struct AttributeOps<rdl2::BoolVector>   : VectorOps<rdl2::BoolVector>   {};
+template <> struct AttributeOps<rdl2::StringVector> : VectorOps<rdl2::StringVector> {};
+#define MATH_OPS(T) template <> struct AttributeOps<T> : MathOps<T> {};
+MATH_OPS(rdl2::Rgb)
+MATH_OPS(rdl2::Rgba)
+MATH_OPS(rdl2::Vec2f)
+MATH_OPS(rdl2::Vec2d)
+MATH_OPS(rdl2::Vec3f)
+MATH_OPS(rdl2::Vec3d)
+MATH_OPS(rdl2::Vec4f)
+MATH_OPS(rdl2::Vec4d)
+MATH_OPS(rdl2::Mat4f)
+MATH_OPS(rdl2::Mat4d)
+#undef MATH_OPS
+#define ARRAY_OPS(V) template <> struct AttributeOps<V> : ArrayOps<V> {};
+ARRAY_OPS(rdl2::IntVector)
+ARRAY_OPS(rdl2::LongVector)
+ARRAY_OPS(rdl2::FloatVector)
+ARRAY_OPS(rdl2::DoubleVector)
+ARRAY_OPS(rdl2::RgbVector)
+ARRAY_OPS(rdl2::RgbaVector)
+ARRAY_OPS(rdl2::Vec2fVector)
+ARRAY_OPS(rdl2::Vec2dVector)
+ARRAY_OPS(rdl2::Vec3fVector)
+ARRAY_OPS(rdl2::Vec3dVector)
+ARRAY_OPS(rdl2::Vec4fVector)
+ARRAY_OPS(rdl2::Vec4dVector)
+ARRAY_OPS(rdl2::Mat4fVector)
+ARRAY_OPS(rdl2::Mat4dVector)
+#undef ARRAY_OPS
+
+// SceneObject references have no timestep.
+template <>
+struct AttributeOps<rdl2::SceneObject*> : ValueOps<rdl2::SceneObject*>
+{
+    static rdl2::SceneObject* const& read(const rdl2::SceneObject& obj,
+                                          rdl2::AttributeKey<rdl2::SceneObject*> key,
+                                          rdl2::AttributeTimestep)
+    {
+        return obj.get(key);
+    }
+    static void write(rdl2::SceneObject& obj, rdl2::AttributeKey<rdl2::SceneObject*> key,
+                      rdl2::SceneObject* value, rdl2::AttributeTimestep)
+    {
+        obj.set(key, value);
+    }
+    static py::object toPython(rdl2::SceneObject* value)
+    {
+        return py::cast(value, py::return_value_policy::reference);
+    }
+};
+
+template <>
+struct AttributeOps<rdl2::SceneObjectVector> : VectorOps<rdl2::SceneObjectVector> {};
+
+// SceneObjectIndexable crosses to Python as a plain list of SceneObjects.
+template <>
+struct AttributeOps<rdl2::SceneObjectIndexable> : VectorOps<rdl2::SceneObjectIndexable>
+{
+    static py::object toPython(const rdl2::SceneObjectIndexable& value)
+    {
+        return py::cast(std::vector<rdl2::SceneObject*>(value.begin(), value.end()),
+                        py::return_value_policy::reference);
+    }
+    static rdl2::SceneObjectIndexable fromPython(py::handle value)
+    {
+        auto list = value.cast<std::vector<rdl2::SceneObject*>>();
+        return rdl2::SceneObjectIndexable(list.begin(), list.end());
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Batch conversion for setMany/getMany.  Element types with ArrayTraits
+// (numbers and math types) go to/from a single ndarray; everything else is
+// converted item by item through a Python sequence.
+// ---------------------------------------------------------------------------
+template <typename Ops>
+std::vector<typename Ops::Type> manyFromSequence(py::handle values)
+{
+    std::vector<typename Ops::Type> result;
+    result.reserve(py::len(values));
+    for (py::handle item : values)
+        result.push_back(Ops::fromPython(item));
+    return result;
+}
+
+template <typename Ops>
+std::vector<typename Ops::Type> manyFromPython(py::handle values, std::false_type)
+{
+    return manyFromSequence<Ops>(values);
+}
+
+template <typename Ops>
+std::vector<typename Ops::Type> manyFromPython(py::handle values, std::true_type)
+{
+    if (py::isinstance<py::buffer>(values))
+        return vectorFromArray<std::vector<typename Ops::Type>>(values);
+    return manyFromSequence<Ops>(values);
+}
+
+template <typename Ops>
+py::object manyToPython(const std::vector<typename Ops::Type>& values, std::false_type)
+{
+    py::list result(values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        result[i] = Ops::toPython(values[i]);
+    return std::move(result);
+}
+
+template <typename Ops>
+py::object manyToPython(const std::vector<typename Ops::Type>& values, std::true_type)
+{
+    return arrayCopy(values);
+}
+
+// ---------------------------------------------------------------------------
+// TypedAttributeHandle<T>: the concrete handle; its vtable is the
+// pre-resolved converter pair for T.
+// ---------------------------------------------------------------------------
+template <typename T>
+class TypedAttributeHandle : public AttributeHandle
+{
+    using Ops = AttributeOps<T>;
+    using IsArray = IsArrayElement<T>;
+
+public:
+    TypedAttributeHandle(const rdl2::SceneClass& sc, const rdl2::Attribute& attr)
+        : AttributeHandle(sc, attr), mKey(attr) {}
+
+    py::object get(const rdl2::SceneObject& obj, rdl2::AttributeTimestep ts) const override
+    {
+        const auto& value = Ops::read(obj, mKey, ts);
+        addProfiledValue(value);
+        return Ops::toPython(value);
+    }
+
+    void set(rdl2::SceneObject& obj, py::handle value, rdl2::AttributeTimestep ts) const override
+    {
+        const T converted = Ops::fromPython(value);
+        addProfiledValue(converted);
+        Ops::write(obj, mKey, converted, ts);
+        recordChange(&obj, mAttribute);
+    }
+
+    py::object getMany(const std::vector<rdl2::SceneObject*>& objs,
+                       const std::vector<const AttributeHandle*>& handles,
+                       rdl2::AttributeTimestep ts) const override
+    {
+        std::vector<T> values;
+        values.reserve(objs.size());
+        {
+            py::gil_scoped_release release;
+            for (size_t i = 0; i < objs.size(); ++i)
+                values.push_back(Ops::read(*objs[i], keyOf(handles[i]), ts));
+        }
+        addProfiledBytes(totalBytes(values));
+        return manyToPython<Ops>(values, IsArray());
+    }
+
+    void setMany(const std::vector<rdl2::SceneObject*>& objs,
+                 const std::vector<const AttributeHandle*>& handles,
+                 py::handle values, rdl2::AttributeTimestep ts) const override
+    {
+        const std::vector<T> converted = manyFromPython<Ops>(values, IsArray());
+        if (converted.size() != objs.size())
+            throw py::value_error("setMany() got " + std::to_string(converted.size()) +
+                                  " values for " + std::to_string(objs.size()) + " objects");
+        // Without the GIL nothing stops another Python thread from touching
+        // these objects while they are written; the binding's docstring makes
+        // that the caller's responsibility.
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < objs.size(); ++i) {
+            UpdateScope guard(objs[i]);
+            Ops::write(*objs[i], keyOf(handles[i]), converted[i], ts);
+            recordChange(objs[i], &handles[i]->getAttribute());
+        }
+        addProfiledBytes(totalBytes(converted));
+    }
+
+private:
+    static uint64_t totalBytes(const std::vector<T>& values)
+    {
+        if (!profilingEnabled())
+            return 0;
+        uint64_t bytes = 0;
+        for (const T& value : values)
+            bytes += convertedBytes(value);
+        return bytes;
+    }
+
+    // Every handle in a batch has been checked to share this attribute type.
+    static rdl2::AttributeKey<T> keyOf(const AttributeHandle* handle)
+    {
+        return static_cast<const TypedAttributeHandle<T>*>(handle)->mKey;
+    }
+
+    rdl2::AttributeKey<T> mKey;
+};
+
+static AttributeHandlePtr createAttributeHandle(const rdl2::SceneClass& sc, const rdl2::Attribute& attr)
+{
+    switch (attr.getType()) {
+        case rdl2::TYPE_BOOL:   return std::make_shared<TypedAttributeHandle<rdl2::Bool>>(sc, attr);
+        case rdl2::TYPE_INT:    return std::make_shared<TypedAttributeHandle<rdl2::Int>>(sc, attr);
+        case rdl2::TYPE_LONG:   return std::make_shared<TypedAttributeHandle<rdl2::Long>>(sc, attr);
+        case rdl2::TYPE_FLOAT:  return std::make_shared<TypedAttributeHandle<rdl2::Float>>(sc, attr);
+        case rdl2::TYPE_DOUBLE: return std::make_shared<TypedAttributeHandle<rdl2::Double>>(sc, attr);
+        case rdl2::TYPE_STRING: return std::make_shared<TypedAttributeHandle<rdl2::String>>(sc, attr);
+        case rdl2::TYPE_RGB:    return std::make_shared<TypedAttributeHandle<rdl2::Rgb>>(sc, attr);
+        case rdl2::TYPE_RGBA:   return std::make_shared<TypedAttributeHandle<rdl2::Rgba>>(sc, attr);
+        case rdl2::TYPE_VEC2F:  return std::make_shared<TypedAttributeHandle<rdl2::Vec2f>>(sc, attr);
+        case rdl2::TYPE_VEC2D:  return std::make_shared<TypedAttributeHandle<rdl2::Vec2d>>(sc, attr);
+        case rdl2::TYPE_VEC3F:  return std::make_shared<TypedAttributeHandle<rdl2::Vec3f>>(sc, attr);
+        case rdl2::TYPE_VEC3D:  return std::make_shared<TypedAttributeHandle<rdl2::Vec3d>>(sc, attr);
+        case rdl2::TYPE_VEC4F:  return std::make_shared<TypedAttributeHandle<rdl2::Vec4f>>(sc, attr);
+        case rdl2::TYPE_VEC4D:  return std::make_shared<TypedAttributeHandle<rdl2::Vec4d>>(sc, attr);
+        case rdl2::TYPE_MAT4F:  return std::make_shared<TypedAttributeHandle<rdl2::Mat4f>>(sc, attr);
+        case rdl2::TYPE_MAT4D:  return std::make_shared<TypedAttributeHandle<rdl2::Mat4d>>(sc, attr);
+        case rdl2::TYPE_SCENE_OBJECT:
+            return std::make_shared<TypedAttributeHandle<rdl2::SceneObject*>>(sc, attr);
+        case rdl2::TYPE_BOOL_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::BoolVector>>(sc, attr);
+        case rdl2::TYPE_INT_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::IntVector>>(sc, attr);
+        case rdl2::TYPE_LONG_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::LongVector>>(sc, attr);
+        case rdl2::TYPE_FLOAT_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::FloatVector>>(sc, attr);
+        case rdl2::TYPE_DOUBLE_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::DoubleVector>>(sc, attr);
+        case rdl2::TYPE_STRING_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::StringVector>>(sc, attr);
+        case rdl2::TYPE_RGB_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::RgbVector>>(sc, attr);
+        case rdl2::TYPE_RGBA_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::RgbaVector>>(sc, attr);
+        case rdl2::TYPE_VEC2F_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec2fVector>>(sc, attr);
+        case rdl2::TYPE_VEC2D_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec2dVector>>(sc, attr);
+        case rdl2::TYPE_VEC3F_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec3fVector>>(sc, attr);
+        case rdl2::TYPE_VEC3D_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec3dVector>>(sc, attr);
+        case rdl2::TYPE_VEC4F_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec4fVector>>(sc, attr);
+        case rdl2::TYPE_VEC4D_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Vec4dVector>>(sc, attr);
+        case rdl2::TYPE_MAT4F_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Mat4fVector>>(sc, attr);
+        case rdl2::TYPE_MAT4D_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::Mat4dVector>>(sc, attr);
+        case rdl2::TYPE_SCENE_OBJECT_VECTOR:
+            return std::make_shared<TypedAttributeHandle<rdl2::SceneObjectVector>>(sc, attr);
+        case rdl2::TYPE_SCENE_OBJECT_INDEXABLE:
+            return std::make_shared<TypedAttributeHandle<rdl2::SceneObjectIndexable>>(sc, attr);
+        default:
+            throw std::runtime_error("Unknown or unsupported attribute type '" +
+                                     std::string(rdl2::attributeTypeName(attr.getType())) +
+                                     "' for attribute '" + attr.getName() + "'");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Handle cache, keyed by SceneClass then attribute name.  SceneClasses live
+// as long as their (never destroyed) SceneContext, so entries never go stale.
+// ---------------------------------------------------------------------------
+const AttributeHandlePtr& getAttributeHandle(const rdl2::SceneClass& sc, const std::string& name)
+{
+    static std::unordered_map<const rdl2::SceneClass*,
+                              std::unordered_map<std::string, AttributeHandlePtr>> sCache;
+    auto& byName = sCache[&sc];
+    auto it = byName.find(name);
+    if (it != byName.end())
+        return it->second;
+    const rdl2::Attribute* attr = sc.getAttribute(name);
+    return byName.emplace(name, createAttributeHandle(sc, *attr)).first->second;
+}
+
+std::vector<const AttributeHandle*> resolveAttributeHandles(
+    const std::vector<rdl2::SceneObject*>& objs, const std::string& name)
+{
+    std::vector<const AttributeHandle*> handles;
+    handles.reserve(objs.size());
+    const rdl2::SceneClass* lastClass = nullptr;
+    const AttributeHandle* last = nullptr;
+    for (rdl2::SceneObject* obj : objs) {
+        if (!obj)
+            throw py::type_error("expected a sequence of SceneObjects, got None");
+        if (&obj->getSceneClass() != lastClass) {
+            lastClass = &obj->getSceneClass();
+            last = getAttributeHandle(*lastClass, name).get();
+            if (!handles.empty() &&
+                last->getAttribute().getType() != handles.front()->getAttribute().getType())
+                throw py::type_error("attribute '" + name + "' has type " +
+                    rdl2::attributeTypeName(last->getAttribute().getType()) + " on class '" +
+                    lastClass->getName() + "' but " +
+                    rdl2::attributeTypeName(handles.front()->getAttribute().getType()) +
+                    " on class '" + handles.front()->getSceneClass().getName() + "'");
+        }
+        handles.push_back(last);
+    }
+    return handles;
+}
+
+// ---------------------------------------------------------------------------
+// bind_attribute_handle
+// ---------------------------------------------------------------------------
+void bind_attribute_handle(py::module_& m)
+{
+    py::class_<AttributeHandle, AttributeHandlePtr>(m, "AttributeHandle",
+        "A SceneClass attribute resolved once for repeated get/set without "
+        "per-call name lookup.")
+        .def(py::init([](const rdl2::SceneClass& sc, const std::string& name) {
+            return getAttributeHandle(sc, name);
+        }), py::arg("scene_class"), py::arg("name"))
+        .def("get", [](const AttributeHandle& self, const rdl2::SceneObject& obj,
+                       rdl2::AttributeTimestep ts) {
+            ProfileScope profile(Probe::HandleGet);
+            self.checkObject(obj);
+            return self.get(obj, ts);
+        }, py::arg("object"), py::arg("timestep") = rdl2::TIMESTEP_BEGIN)
+        .def("set", [](const AttributeHandle& self, rdl2::SceneObject& obj,
+                       py::object value, rdl2::AttributeTimestep ts) {
+            ProfileScope profile(Probe::HandleSet);
+            self.checkObject(obj);
+            UpdateScope guard(&obj);
+            self.set(obj, value, ts);
+        }, py::arg("object"), py::arg("value"), py::arg("timestep") = rdl2::TIMESTEP_BEGIN)
+        .def("getSceneClass", &AttributeHandle::getSceneClass,
+             py::return_value_policy::reference)
+        .def("getAttribute", &AttributeHandle::getAttribute,
+             py::return_value_policy::reference)
+        .def("getName", [](const AttributeHandle& self) {
+            return self.getAttribute().getName();
+        })
+        .def("getType", [](const AttributeHandle& self) {
+            return self.getAttribute().getType();
+        })
+        .def("__repr__", [](const AttributeHandle& self) {
+            return "<AttributeHandle '" + self.getSceneClass().getName() + "." +
+                   self.getAttribute().getName() + "'>";
+        });
+}
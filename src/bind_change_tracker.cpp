@@ -0,0 +1,191 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// ChangeTracker: records which SceneObjects (and attributes) the bindings
+// modify, so Python can ask "what changed since the last commit" without
+// scanning the context, and emit a delta-encoded BinaryWriter frame.
+//
+// Changes are reported through recordChange() (update_scope.h), which every
+// UpdateScope and the AttributeHandle setters call.  Edits made directly in
+// C++ (e.g. by readers) are not recorded, but they are still included in the
+// emitted delta because rdl2's delta encoding works from its own dirty flags.
+
+#include "bindings.h"
+#include "context_io.h"
+#include "update_scope.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+class ChangeTracker;
+
+std::atomic<int> gRecordingChangeTrackers{0};
+
+// Registry of recording trackers.  Recording may happen without the GIL
+// (e.g. SceneContext.setMany), so it is guarded by its own mutex.
+static std::mutex sTrackersMutex;
+static std::vector<ChangeTracker*> sTrackers;
+
+class ChangeTracker
+{
+public:
+    explicit ChangeTracker(rdl2::SceneContext& ctx) : mContext(&ctx) {}
+    ~ChangeTracker() { stop(); }
+
+    ChangeTracker(const ChangeTracker&) = delete;
+    ChangeTracker& operator=(const ChangeTracker&) = delete;
+
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        if (mRecording)
+            return;
+        sTrackers.push_back(this);
+        mRecording = true;
+        ++gRecordingChangeTrackers;
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        if (!mRecording)
+            return;
+        sTrackers.erase(std::find(sTrackers.begin(), sTrackers.end(), this));
+        mRecording = false;
+        --gRecordingChangeTrackers;
+    }
+
+    bool isRecording() const { return mRecording; }
+
+    // Called with sTrackersMutex held.
+    void record(const rdl2::SceneObject* obj, const rdl2::Attribute* attr)
+    {
+        if (obj->getSceneClass().getSceneContext() != mContext)
+            return;
+        auto it = mIndex.find(obj);
+        if (it == mIndex.end()) {
+            it = mIndex.emplace(obj, mChanges.size()).first;
+            mChanges.emplace_back(const_cast<rdl2::SceneObject*>(obj),
+                                  std::vector<const rdl2::Attribute*>());
+        }
+        if (attr) {
+            auto& attrs = mChanges[it->second].second;
+            if (std::find(attrs.begin(), attrs.end(), attr) == attrs.end())
+                attrs.push_back(attr);
+        }
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        return mChanges.size();
+    }
+
+    std::vector<rdl2::SceneObject*> getChangedObjects() const
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        std::vector<rdl2::SceneObject*> result;
+        result.reserve(mChanges.size());
+        for (const auto& change : mChanges)
+            result.push_back(change.first);
+        return result;
+    }
+
+    std::vector<std::string> getChangedAttributes(const rdl2::SceneObject& obj) const
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        std::vector<std::string> result;
+        auto it = mIndex.find(&obj);
+        if (it != mIndex.end())
+            for (const rdl2::Attribute* attr : mChanges[it->second].second)
+                result.push_back(attr->getName());
+        return result;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(sTrackersMutex);
+        mChanges.clear();
+        mIndex.clear();
+    }
+
+    // Serializes the delta since the last commitAllChanges(): only dirty
+    // objects, and only their changed attributes.  With `commit`, the context
+    // is committed and the recorded changes are cleared afterwards.
+    void writeDelta(std::string& manifest, std::string& payload, bool commit)
+    {
+        {
+            py::gil_scoped_release release;
+            rdl2::BinaryWriter writer(*mContext);
+            writer.setDeltaEncoding(true);
+            writer.toBytes(manifest, payload);
+            if (commit)
+                mContext->commitAllChanges();
+        }
+        if (commit)
+            clear();
+    }
+
+private:
+    rdl2::SceneContext* mContext;
+    bool mRecording = false;
+    // Changed objects in first-change order, each with its changed attributes.
+    std::vector<std::pair<rdl2::SceneObject*, std::vector<const rdl2::Attribute*>>> mChanges;
+    std::unordered_map<const rdl2::SceneObject*, size_t> mIndex;
+};
+
+void recordChangeToTrackers(const rdl2::SceneObject* obj, const rdl2::Attribute* attr)
+{
+    std::lock_guard<std::mutex> lock(sTrackersMutex);
+    for (ChangeTracker* tracker : sTrackers)
+        tracker->record(obj, attr);
+}
+
+// ---------------------------------------------------------------------------
+// bind_change_tracker
+// ---------------------------------------------------------------------------
+void bind_change_tracker(py::module_& m)
+{
+    py::class_<ChangeTracker>(m, "ChangeTracker",
+        "Records the SceneObjects and attributes modified through the bindings "
+        "and emits delta-encoded binary updates for them.")
+        .def(py::init([](rdl2::SceneContext& ctx, bool start) {
+            auto tracker = std::unique_ptr<ChangeTracker>(new ChangeTracker(ctx));
+            if (start)
+                tracker->start();
+            return tracker;
+        }), py::arg("context"), py::arg("start") = true, py::keep_alive<1, 2>())
+        .def("start", &ChangeTracker::start)
+        .def("stop", &ChangeTracker::stop)
+        .def("isRecording", &ChangeTracker::isRecording)
+        .def("hasChanges", [](const ChangeTracker& self) { return self.size() != 0; })
+        .def("__len__", &ChangeTracker::size)
+        .def("getChangedObjects", &ChangeTracker::getChangedObjects,
+             py::return_value_policy::reference,
+             "Objects modified since the last clear, in first-change order.")
+        .def("getChangedAttributes", &ChangeTracker::getChangedAttributes,
+             py::arg("object"),
+             "Names of the attributes of `object` set by name or handle since the "
+             "last clear.  Other edits (set membership, bindings, ...) mark only "
+             "the object.")
+        .def("clear", &ChangeTracker::clear)
+        .def("toBytes", [](ChangeTracker& self, bool commit) {
+                std::string manifest, payload;
+                self.writeDelta(manifest, payload, commit);
+                return py::make_tuple(py::bytes(manifest), py::bytes(payload));
+             },
+             py::arg("commit") = false,
+             "Delta-encode the changes since the last commitAllChanges() and "
+             "return (manifest, payload).  With commit=True, also commit the "
+             "context and clear the tracker.")
+        .def("toStream", [](ChangeTracker& self, py::object writer, bool commit) {
+                std::string manifest, payload;
+                self.writeDelta(manifest, payload, commit);
+                return writeFrameToStream(writer, std::move(manifest), std::move(payload));
+             },
+             py::arg("writer"), py::arg("commit") = false,
+             "Like toBytes(), but write the delta as one framed-stream frame "
+             "(see BinaryReader.fromStream) to a binary file-like object, "
+             "passing it memoryviews that own their buffers.");
+}
@@ -0,0 +1,321 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// SceneContext.dependencyGraph(): the scene's object reference graph, built
+// in C++ as CSR adjacency arrays, with closure and ordering queries.
+//
+// There is an edge from A to B when A depends on B: B is bound to one of A's
+// attributes, or is the value (or an entry) of one of A's SceneObject,
+// SceneObjectVector or SceneObjectIndexable attributes.  rdl2 keeps set
+// membership and Layer assignments in such attributes, so those edges come
+// from the same scan.  Each edge appears once however many attributes carry
+// it.
+//
+// Edges are extracted in parallel with TBB.  The graph is a snapshot: it
+// does not see objects or references added after it was built.  The context
+// must not be modified while it is being built.
+
+#include "bindings.h"
+
+#include <pybind11/numpy.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+// Compressed sparse rows: the neighbours of node i are
+// targets[offsets[i] .. offsets[i + 1]).
+struct Csr
+{
+    std::vector<int64_t> offsets;
+    std::vector<int32_t> targets;
+
+    int64_t degree(size_t i) const { return offsets[i + 1] - offsets[i]; }
+    const int32_t* begin(size_t i) const { return targets.data() + offsets[i]; }
+    const int32_t* end(size_t i) const { return targets.data() + offsets[i + 1]; }
+};
+
+// The attributes of one SceneClass that can carry edges.
+struct ReferenceAttributes
+{
+    std::vector<const rdl2::Attribute*> bindable;
+    std::vector<const rdl2::Attribute*> objects;        // TYPE_SCENE_OBJECT
+    std::vector<const rdl2::Attribute*> objectVectors;  // TYPE_SCENE_OBJECT_VECTOR
+    std::vector<const rdl2::Attribute*> indexables;     // TYPE_SCENE_OBJECT_INDEXABLE
+};
+
+static ReferenceAttributes referenceAttributes(const rdl2::SceneClass& sc)
+{
+    ReferenceAttributes result;
+    for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it) {
+        const rdl2::Attribute* attr = *it;
+        if (attr->isBindable())
+            result.bindable.push_back(attr);
+        switch (attr->getType()) {
+            case rdl2::TYPE_SCENE_OBJECT:           result.objects.push_back(attr); break;
+            case rdl2::TYPE_SCENE_OBJECT_VECTOR:    result.objectVectors.push_back(attr); break;
+            case rdl2::TYPE_SCENE_OBJECT_INDEXABLE: result.indexables.push_back(attr); break;
+            default: break;
+        }
+    }
+    return result;
+}
+
+class DependencyGraph
+{
+public:
+    explicit DependencyGraph(const rdl2::SceneContext& ctx)
+    {
+        for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+            mObjects.push_back(it->second);
+        mIndex.reserve(mObjects.size());
+        std::unordered_map<const rdl2::SceneClass*, ReferenceAttributes> classes;
+        for (size_t i = 0; i < mObjects.size(); ++i) {
+            mIndex.emplace(mObjects[i], static_cast<int32_t>(i));
+            const rdl2::SceneClass& sc = mObjects[i]->getSceneClass();
+            if (!classes.count(&sc))
+                classes.emplace(&sc, referenceAttributes(sc));
+        }
+
+        std::vector<std::vector<int32_t>> edges(mObjects.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, mObjects.size(), 64),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    collectEdges(*mObjects[i], classes.at(&mObjects[i]->getSceneClass()),
+                                 edges[i]);
+            });
+
+        mForward.offsets.assign(mObjects.size() + 1, 0);
+        for (size_t i = 0; i < edges.size(); ++i)
+            mForward.offsets[i + 1] = mForward.offsets[i] + static_cast<int64_t>(edges[i].size());
+        mForward.targets.reserve(static_cast<size_t>(mForward.offsets.back()));
+        for (const std::vector<int32_t>& list : edges)
+            mForward.targets.insert(mForward.targets.end(), list.begin(), list.end());
+        mReverse = transpose(mForward);
+    }
+
+    size_t size() const { return mObjects.size(); }
+    size_t edgeCount() const { return mForward.targets.size(); }
+    const std::vector<rdl2::SceneObject*>& objects() const { return mObjects; }
+    const Csr& csr(bool reverse) const { return reverse ? mReverse : mForward; }
+
+    int32_t indexOf(const rdl2::SceneObject* obj) const
+    {
+        if (!obj)
+            throw py::value_error("expected a SceneObject, got None");
+        auto found = mIndex.find(obj);
+        if (found == mIndex.end())
+            throw py::key_error("'" + obj->getName() + "' is not in this dependency graph");
+        return found->second;
+    }
+
+    // Every object reachable from `roots` along `edges`, roots included, in
+    // graph order.
+    std::vector<rdl2::SceneObject*> reachable(const std::vector<rdl2::SceneObject*>& roots,
+                                              const Csr& edges) const
+    {
+        std::vector<char> seen(mObjects.size(), 0);
+        std::vector<int32_t> stack;
+        for (const rdl2::SceneObject* root : roots) {
+            const int32_t i = indexOf(root);
+            if (!seen[i]) {
+                seen[i] = 1;
+                stack.push_back(i);
+            }
+        }
+        py::gil_scoped_release release;
+        while (!stack.empty()) {
+            const int32_t i = stack.back();
+            stack.pop_back();
+            for (const int32_t* t = edges.begin(i); t != edges.end(i); ++t)
+                if (!seen[*t]) {
+                    seen[*t] = 1;
+                    stack.push_back(*t);
+                }
+        }
+        std::vector<rdl2::SceneObject*> result;
+        for (size_t i = 0; i < seen.size(); ++i)
+            if (seen[i])
+                result.push_back(mObjects[i]);
+        return result;
+    }
+
+    // Every object after everything it depends on (Kahn's algorithm).
+    // Throws ValueError if the graph has a cycle.
+    std::vector<rdl2::SceneObject*> topologicalOrder() const
+    {
+        std::vector<int64_t> pending(mObjects.size());
+        std::deque<int32_t> ready;
+        for (size_t i = 0; i < mObjects.size(); ++i) {
+            pending[i] = mForward.degree(i);
+            if (!pending[i])
+                ready.push_back(static_cast<int32_t>(i));
+        }
+        std::vector<rdl2::SceneObject*> order;
+        order.reserve(mObjects.size());
+        {
+            py::gil_scoped_release release;
+            while (!ready.empty()) {
+                const int32_t i = ready.front();
+                ready.pop_front();
+                order.push_back(mObjects[i]);
+                for (const int32_t* d = mReverse.begin(i); d != mReverse.end(i); ++d)
+                    if (--pending[*d] == 0)
+                        ready.push_back(*d);
+            }
+        }
+        if (order.size() != mObjects.size()) {
+            // Every object left over still depends on another left-over
+            // object, so following those edges must come back around.
+            int32_t i = static_cast<int32_t>(
+                std::find_if(pending.begin(), pending.end(), [](int64_t n) { return n > 0; }) -
+                pending.begin());
+            std::vector<char> visited(mObjects.size(), 0);
+            while (!visited[i]) {
+                visited[i] = 1;
+                i = *std::find_if(mForward.begin(i), mForward.end(i),
+                                  [&](int32_t t) { return pending[t] > 0; });
+            }
+            throw py::value_error("dependency graph has a cycle through '" +
+                                  mObjects[i]->getName() + "'");
+        }
+        return order;
+    }
+
+private:
+    void addEdge(const rdl2::SceneObject* target, std::vector<int32_t>& out) const
+    {
+        if (!target)
+            return;
+        auto found = mIndex.find(target);
+        if (found != mIndex.end())
+            out.push_back(found->second);
+    }
+
+    void collectEdges(const rdl2::SceneObject& obj, const ReferenceAttributes& attrs,
+                      std::vector<int32_t>& out) const
+    {
+        for (const rdl2::Attribute* attr : attrs.bindable)
+            addEdge(obj.getBinding(*attr), out);
+        for (const rdl2::Attribute* attr : attrs.objects)
+            addEdge(obj.get(rdl2::AttributeKey<rdl2::SceneObject*>(*attr)), out);
+        for (const rdl2::Attribute* attr : attrs.objectVectors)
+            for (const rdl2::SceneObject* target :
+                 obj.get(rdl2::AttributeKey<rdl2::SceneObjectVector>(*attr)))
+                addEdge(target, out);
+        for (const rdl2::Attribute* attr : attrs.indexables)
+            for (const rdl2::SceneObject* target :
+                 obj.get(rdl2::AttributeKey<rdl2::SceneObjectIndexable>(*attr)))
+                addEdge(target, out);
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    static Csr transpose(const Csr& csr)
+    {
+        const size_t n = csr.offsets.size() - 1;
+        Csr result;
+        result.offsets.assign(n + 1, 0);
+        for (int32_t t : csr.targets)
+            ++result.offsets[t + 1];
+        for (size_t i = 0; i < n; ++i)
+            result.offsets[i + 1] += result.offsets[i];
+        result.targets.resize(csr.targets.size());
+        std::vector<int64_t> fill(result.offsets.begin(), result.offsets.end() - 1);
+        // Sources are visited in order, so each row comes out sorted.
+        for (size_t i = 0; i < n; ++i)
+            for (const int32_t* t = csr.begin(i); t != csr.end(i); ++t)
+                result.targets[fill[*t]++] = static_cast<int32_t>(i);
+        return result;
+    }
+
+    std::vector<rdl2::SceneObject*> mObjects;
+    std::unordered_map<const rdl2::SceneObject*, int32_t> mIndex;
+    Csr mForward;
+    Csr mReverse;
+};
+
+py::object dependencyGraph(const rdl2::SceneContext& ctx)
+{
+    std::unique_ptr<DependencyGraph> graph;
+    {
+        py::gil_scoped_release release;
+        graph.reset(new DependencyGraph(ctx));
+    }
+    return py::cast(std::move(graph));
+}
+
+template <typename T>
+static py::array_t<T> toArray(const std::vector<T>& values)
+{
+    py::array_t<T> result(static_cast<py::ssize_t>(values.size()));
+    std::copy(values.begin(), values.end(), result.mutable_data());
+    return result;
+}
+
+static py::list neighbours(const DependencyGraph& self, const rdl2::SceneObject* obj,
+                           bool reverse)
+{
+    const Csr& edges = self.csr(reverse);
+    const int32_t i = self.indexOf(obj);
+    py::list result;
+    for (const int32_t* t = edges.begin(i); t != edges.end(i); ++t)
+        result.append(py::cast(self.objects()[*t], py::return_value_policy::reference));
+    return result;
+}
+
+void bind_dependency_graph(py::module_& m)
+{
+    py::class_<DependencyGraph>(m, "DependencyGraph",
+        "Object reference graph of a SceneContext (see SceneContext.dependencyGraph). "
+        "An edge runs from each object to every object it depends on.")
+        .def("__len__", &DependencyGraph::size)
+        .def("edgeCount", &DependencyGraph::edgeCount)
+        .def("objects", &DependencyGraph::objects, py::return_value_policy::reference,
+             "The graph's nodes; node i is objects()[i].")
+        .def("indexOf", &DependencyGraph::indexOf, py::arg("object"),
+             "Node number of `object`.  Raises KeyError if it is not in the graph.")
+        .def("offsets", [](const DependencyGraph& self, bool reverse) {
+                return toArray(self.csr(reverse).offsets);
+             },
+             py::arg("reverse") = false,
+             "int64 CSR row offsets: node i's edges are targets()[offsets[i]:offsets[i + 1]].  "
+             "With reverse=True, the rows list each node's dependents instead.")
+        .def("targets", [](const DependencyGraph& self, bool reverse) {
+                return toArray(self.csr(reverse).targets);
+             },
+             py::arg("reverse") = false,
+             "int32 CSR edge targets, sorted within each row (see offsets()).")
+        .def("dependencies", [](const DependencyGraph& self, const rdl2::SceneObject* obj) {
+                return neighbours(self, obj, false);
+             },
+             py::arg("object"), "Objects that `object` references directly.")
+        .def("dependents", [](const DependencyGraph& self, const rdl2::SceneObject* obj) {
+                return neighbours(self, obj, true);
+             },
+             py::arg("object"), "Objects that reference `object` directly.")
+        .def("closure", [](const DependencyGraph& self,
+                           const std::vector<rdl2::SceneObject*>& roots) {
+                return self.reachable(roots, self.csr(false));
+             },
+             py::arg("roots"), py::return_value_policy::reference,
+             "Every object that `roots` depend on, directly or not, plus the roots "
+             "themselves, in graph order.")
+        .def("reverseClosure", [](const DependencyGraph& self,
+                                  const std::vector<rdl2::SceneObject*>& objects) {
+                return self.reachable(objects, self.csr(true));
+             },
+             py::arg("objects"), py::return_value_policy::reference,
+             "Every object that depends on `objects`, directly or not, plus the "
+             "objects themselves: what a change to them can affect.")
+        .def("topologicalOrder", &DependencyGraph::topologicalOrder,
+             py::return_value_policy::reference,
+             "Every object, each after all of its dependencies.  Raises ValueError "
+             "if the graph has a cycle.")
+        .def("__repr__", [](const DependencyGraph& self) {
+            return "<DependencyGraph " + std::to_string(self.size()) + " objects, " +
+                   std::to_string(self.edgeCount()) + " edges>";
+        });
+}
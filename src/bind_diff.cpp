@@ -0,0 +1,308 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// scene_rdl2.diff(): compares two SceneContexts in C++.
+//
+// Objects are matched by name.  Each matched pair is compared attribute by
+// attribute with typed rdl2 reads (both timesteps for blurrable attributes,
+// plus bindings), with the pairs spread across threads by TBB.  Floating-point
+// components compare equal within atol + rtol * |b|, and NaN equals NaN.
+// SceneObject references compare by name, since the two contexts never share
+// objects.  Neither context may be modified while diff() runs.
+
+#include "bindings.h"
+#include "arrays.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <type_traits>
+#include <unordered_set>
+
+struct Tolerance
+{
+    double rtol = 0.0;
+    double atol = 0.0;
+};
+
+// ---------------------------------------------------------------------------
+// Typed comparison
+// ---------------------------------------------------------------------------
+template <typename T, bool = IsArrayElement<T>::value>
+struct IsFloatElement : std::false_type {};
+template <typename T>
+struct IsFloatElement<T, true> : std::is_floating_point<typename ArrayTraits<T>::Scalar> {};
+
+template <typename S>
+static bool scalarsClose(S a, S b, const Tolerance& tol)
+{
+    if (a == b || (std::isnan(a) && std::isnan(b)))
+        return true;
+    return std::abs(double(a) - double(b)) <= tol.atol + tol.rtol * std::abs(double(b));
+}
+
+template <typename T>
+static bool valuesEqual(const T& a, const T& b, const Tolerance& tol, std::true_type /*float*/)
+{
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    constexpr size_t components = sizeof(T) / sizeof(Scalar);
+    const Scalar* pa = reinterpret_cast<const Scalar*>(&a);
+    const Scalar* pb = reinterpret_cast<const Scalar*>(&b);
+    for (size_t i = 0; i < components; ++i)
+        if (!scalarsClose(pa[i], pb[i], tol))
+            return false;
+    return true;
+}
+
+template <typename T>
+static bool valuesEqual(const T& a, const T& b, const Tolerance&, std::false_type)
+{
+    return a == b;
+}
+
+static bool sameObject(const rdl2::SceneObject* a, const rdl2::SceneObject* b)
+{
+    if (!a || !b)
+        return a == b;
+    return a->getName() == b->getName();
+}
+
+template <typename T>
+static bool valuesEqual(const T& a, const T& b, const Tolerance& tol)
+{
+    return valuesEqual(a, b, tol, IsFloatElement<T>());
+}
+
+// Elements of SceneObjectVector / SceneObjectIndexable.
+template <>
+bool valuesEqual(rdl2::SceneObject* const& a, rdl2::SceneObject* const& b, const Tolerance&)
+{
+    return sameObject(a, b);
+}
+
+template <typename T>
+static bool scalarAttrEqual(const rdl2::SceneObject& a, const rdl2::Attribute& attrA,
+                            const rdl2::SceneObject& b, const rdl2::Attribute& attrB,
+                            const Tolerance& tol)
+{
+    const rdl2::AttributeKey<T> keyA(attrA), keyB(attrB);
+    if (!valuesEqual(a.get(keyA, rdl2::TIMESTEP_BEGIN), b.get(keyB, rdl2::TIMESTEP_BEGIN), tol))
+        return false;
+    return !attrA.isBlurrable() ||
+           valuesEqual(a.get(keyA, rdl2::TIMESTEP_END), b.get(keyB, rdl2::TIMESTEP_END), tol);
+}
+
+// Vectors (including SceneObjectVector and SceneObjectIndexable) have no
+// timesteps and compare element by element.
+template <typename V>
+static bool vectorAttrEqual(const rdl2::SceneObject& a, const rdl2::Attribute& attrA,
+                            const rdl2::SceneObject& b, const rdl2::Attribute& attrB,
+                            const Tolerance& tol)
+{
+    const V& va = a.get(rdl2::AttributeKey<V>(attrA));
+    const V& vb = b.get(rdl2::AttributeKey<V>(attrB));
+    auto ia = va.begin(), ib = vb.begin();
+    for (; ia != va.end() && ib != vb.end(); ++ia, ++ib)
+        if (!valuesEqual(*ia, *ib, tol))
+            return false;
+    return ia == va.end() && ib == vb.end();
+}
+
+static bool attributeEqual(const rdl2::SceneObject& a, const rdl2::Attribute& attrA,
+                           const rdl2::SceneObject& b, const rdl2::Attribute& attrB,
+                           const Tolerance& tol)
+{
+    if (attrA.isBindable() && !sameObject(a.getBinding(attrA), b.getBinding(attrB)))
+        return false;
+
+#define SCALAR(TYPE, T) case rdl2::TYPE: return scalarAttrEqual<T>(a, attrA, b, attrB, tol);
+#define VECTOR(TYPE, V) case rdl2::TYPE: return vectorAttrEqual<V>(a, attrA, b, attrB, tol);
+    switch (attrA.getType()) {
+        SCALAR(TYPE_BOOL,   rdl2::Bool)
+        SCALAR(TYPE_INT,    rdl2::Int)
+        SCALAR(TYPE_LONG,   rdl2::Long)
+        SCALAR(TYPE_FLOAT,  rdl2::Float)
+        SCALAR(TYPE_DOUBLE, rdl2::Double)
+        SCALAR(TYPE_STRING, rdl2::String)
+        SCALAR(TYPE_RGB,    rdl2::Rgb)
+        SCALAR(TYPE_RGBA,   rdl2::Rgba)
+        SCALAR(TYPE_VEC2F,  rdl2::Vec2f)
+        SCALAR(TYPE_VEC2D,  rdl2::Vec2d)
+        SCALAR(TYPE_VEC3F,  rdl2::Vec3f)
+        SCALAR(TYPE_VEC3D,  rdl2::Vec3d)
+        SCALAR(TYPE_VEC4F,  rdl2::Vec4f)
+        SCALAR(TYPE_VEC4D,  rdl2::Vec4d)
+        SCALAR(TYPE_MAT4F,  rdl2::Mat4f)
+        SCALAR(TYPE_MAT4D,  rdl2::Mat4d)
+        case rdl2::TYPE_SCENE_OBJECT: {
+            const rdl2::AttributeKey<rdl2::SceneObject*> keyA(attrA), keyB(attrB);
+            return sameObject(a.get(keyA), b.get(keyB));
+        }
+        VECTOR(TYPE_BOOL_VECTOR,   rdl2::BoolVector)
+        VECTOR(TYPE_INT_VECTOR,    rdl2::IntVector)
+        VECTOR(TYPE_LONG_VECTOR,   rdl2::LongVector)
+        VECTOR(TYPE_FLOAT_VECTOR,  rdl2::FloatVector)
+        VECTOR(TYPE_DOUBLE_VECTOR, rdl2::DoubleVector)
+        VECTOR(TYPE_STRING_VECTOR, rdl2::StringVector)
+        VECTOR(TYPE_RGB_VECTOR,    rdl2::RgbVector)
+        VECTOR(TYPE_RGBA_VECTOR,   rdl2::RgbaVector)
+        VECTOR(TYPE_VEC2F_VECTOR,  rdl2::Vec2fVector)
+        VECTOR(TYPE_VEC2D_VECTOR,  rdl2::Vec2dVector)
+        VECTOR(TYPE_VEC3F_VECTOR,  rdl2::Vec3fVector)
+        VECTOR(TYPE_VEC3D_VECTOR,  rdl2::Vec3dVector)
+        VECTOR(TYPE_VEC4F_VECTOR,  rdl2::Vec4fVector)
+        VECTOR(TYPE_VEC4D_VECTOR,  rdl2::Vec4dVector)
+        VECTOR(TYPE_MAT4F_VECTOR,  rdl2::Mat4fVector)
+        VECTOR(TYPE_MAT4D_VECTOR,  rdl2::Mat4dVector)
+        VECTOR(TYPE_SCENE_OBJECT_VECTOR,    rdl2::SceneObjectVector)
+        VECTOR(TYPE_SCENE_OBJECT_INDEXABLE, rdl2::SceneObjectIndexable)
+        default:
+            return true;
+    }
+#undef SCALAR
+#undef VECTOR
+}
+
+// ---------------------------------------------------------------------------
+// Per-class-pair plans: attributes matched by name and type.  Attributes
+// present on one side only (or retyped) always count as changed.
+// ---------------------------------------------------------------------------
+struct ClassPairPlan
+{
+    std::vector<std::pair<const rdl2::Attribute*, const rdl2::Attribute*>> matched;
+    std::vector<std::string> unmatched;
+};
+
+static ClassPairPlan planClassPair(const rdl2::SceneClass& a, const rdl2::SceneClass& b,
+                                   const std::unordered_set<std::string>& ignore)
+{
+    std::map<std::string, const rdl2::Attribute*> attrsB;
+    for (auto it = b.beginAttributes(); it != b.endAttributes(); ++it)
+        if (!ignore.count((*it)->getName()))
+            attrsB.emplace((*it)->getName(), *it);
+
+    ClassPairPlan plan;
+    for (auto it = a.beginAttributes(); it != a.endAttributes(); ++it) {
+        const rdl2::Attribute* attrA = *it;
+        if (ignore.count(attrA->getName()))
+            continue;
+        auto match = attrsB.find(attrA->getName());
+        if (match != attrsB.end() && match->second->getType() == attrA->getType())
+            plan.matched.emplace_back(attrA, match->second);
+        else
+            plan.unmatched.push_back(attrA->getName());
+        if (match != attrsB.end())
+            attrsB.erase(match);
+    }
+    for (const auto& rest : attrsB)
+        plan.unmatched.push_back(rest.first);
+    return plan;
+}
+
+// ---------------------------------------------------------------------------
+// SceneDiff result
+// ---------------------------------------------------------------------------
+struct SceneDiff
+{
+    std::vector<std::string> added;    // in b only
+    std::vector<std::string> removed;  // in a only
+    std::vector<std::pair<std::string, std::vector<std::string>>> changed;
+
+    bool empty() const { return added.empty() && removed.empty() && changed.empty(); }
+};
+
+static SceneDiff diff(const rdl2::SceneContext& ctxA, const rdl2::SceneContext& ctxB,
+                      double rtol, double atol, const std::vector<std::string>& ignoreList)
+{
+    if (rtol < 0.0 || atol < 0.0)
+        throw py::value_error("diff() tolerances must be non-negative");
+    const Tolerance tol{rtol, atol};
+    const std::unordered_set<std::string> ignore(ignoreList.begin(), ignoreList.end());
+
+    SceneDiff result;
+    std::vector<std::pair<const rdl2::SceneObject*, const rdl2::SceneObject*>> pairs;
+    std::vector<const ClassPairPlan*> pairPlans;
+    std::map<std::pair<const rdl2::SceneClass*, const rdl2::SceneClass*>, ClassPairPlan> plans;
+    {
+        py::gil_scoped_release release;
+        // Match by name; objects whose class changed are reported as removed
+        // and added.
+        for (auto it = ctxA.beginSceneObject(); it != ctxA.endSceneObject(); ++it) {
+            const rdl2::SceneObject* a = it->second;
+            const rdl2::SceneObject* b = ctxB.sceneObjectExists(it->first)
+                                       ? ctxB.getSceneObject(it->first) : nullptr;
+            if (!b || b->getSceneClass().getName() != a->getSceneClass().getName()) {
+                result.removed.push_back(it->first);
+                if (b)
+                    result.added.push_back(it->first);
+                continue;
+            }
+            auto key = std::make_pair(&a->getSceneClass(), &b->getSceneClass());
+            auto plan = plans.find(key);
+            if (plan == plans.end())
+                plan = plans.emplace(key, planClassPair(*key.first, *key.second, ignore)).first;
+            pairs.emplace_back(a, b);
+            pairPlans.push_back(&plan->second);
+        }
+        for (auto it = ctxB.beginSceneObject(); it != ctxB.endSceneObject(); ++it)
+            if (!ctxA.sceneObjectExists(it->first))
+                result.added.push_back(it->first);
+        std::sort(result.added.begin(), result.added.end());
+        std::sort(result.removed.begin(), result.removed.end());
+
+        std::vector<std::vector<std::string>> changedAttrs(pairs.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, pairs.size(), 64),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const ClassPairPlan& plan = *pairPlans[i];
+                    std::vector<std::string>& out = changedAttrs[i];
+                    out = plan.unmatched;
+                    for (const auto& match : plan.matched)
+                        if (!attributeEqual(*pairs[i].first, *match.first,
+                                            *pairs[i].second, *match.second, tol))
+                            out.push_back(match.first->getName());
+                }
+            });
+        for (size_t i = 0; i < pairs.size(); ++i)
+            if (!changedAttrs[i].empty())
+                result.changed.emplace_back(pairs[i].first->getName(), std::move(changedAttrs[i]));
+        std::sort(result.changed.begin(), result.changed.end());
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// bind_diff
+// ---------------------------------------------------------------------------
+void bind_diff(py::module_& m)
+{
+    py::class_<SceneDiff>(m, "SceneDiff",
+        "Result of diff(): object names added to and removed from the second "
+        "context, and the changed attributes of objects present in both.")
+        .def_readonly("added", &SceneDiff::added)
+        .def_readonly("removed", &SceneDiff::removed)
+        .def_property_readonly("changed", [](const SceneDiff& self) {
+            py::dict changed;
+            for (const auto& entry : self.changed)
+                changed[py::str(entry.first)] = py::cast(entry.second);
+            return changed;
+        }, "{object name: [attribute names]}, in object name order.")
+        .def("isEmpty", &SceneDiff::empty)
+        .def("__bool__", [](const SceneDiff& self) { return !self.empty(); })
+        .def("__repr__", [](const SceneDiff& self) {
+            return "<SceneDiff +" + std::to_string(self.added.size()) +
+                   " -" + std::to_string(self.removed.size()) +
+                   " ~" + std::to_string(self.changed.size()) + ">";
+        });
+
+    m.def("diff", &diff,
+          py::arg("a"), py::arg("b"), py::arg("rtol") = 0.0, py::arg("atol") = 0.0,
+          py::arg("ignore") = std::vector<std::string>(),
+          "Compare SceneContext `a` to `b`, matching objects by name, and return "
+          "a SceneDiff.  Floating-point components are equal within "
+          "atol + rtol * |b|.  Attributes named in `ignore` are skipped.  Objects "
+          "whose SceneClass differs are reported as removed and added.");
+}
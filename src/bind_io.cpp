@@ -1,21 +1,373 @@
 // Copyright (c) 2026 Alan Blevins
 // SPDX-License-Identifier: MIT
 //
-// Python bindings for AsciiReader, AsciiWriter, and module-level free functions.
+// Python bindings for AsciiReader, AsciiWriter, BinaryReader, BinaryWriter,
+// and module-level free functions.
+//
+// Parsing and serialization run with the GIL released (see "Threading" in
+// README.md): arguments are converted to C++ first, the rdl2 call runs
+// without the GIL, and results are converted back once it is reacquired.
 
 #include "bindings.h"
+#include "context_io.h"
+#include "mapped_file.h"
+#include "profiling.h"
+#include "stream_format.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <system_error>
+#include <tuple>
+
+// ---------------------------------------------------------------------------
+// ChunkSource: pulls bytes from a Python byte source into caller-owned
+// memory.  Accepts
+//   - a binary file-like object with readinto(): data is read straight into
+//     the destination through a memoryview, with no intermediate copy;
+//   - a single bytes-like object;
+//   - an iterable of bytes-like chunks (e.g. a generator): each chunk is
+//     accessed through the buffer protocol and copied once into place.
+// Requires the GIL.
+// ---------------------------------------------------------------------------
+class ChunkSource
+{
+public:
+    explicit ChunkSource(py::object source)
+    {
+        if (py::hasattr(source, "readinto"))
+            mReadinto = source.attr("readinto");
+        else if (py::isinstance<py::buffer>(source))
+            setChunk(source);
+        else
+            mChunks = py::iter(source);
+    }
+
+    // Fills up to `n` bytes of `dst`; returns fewer only at end of stream.
+    size_t read(char* dst, size_t n)
+    {
+        size_t got = 0;
+        while (got < n) {
+            size_t step = mReadinto ? readInto(dst + got, n - got) : readChunk(dst + got, n - got);
+            if (step == 0)
+                break;
+            got += step;
+        }
+        return got;
+    }
+
+private:
+    size_t readInto(char* dst, size_t n)
+    {
+        py::object result = mReadinto(py::memoryview::from_memory(dst, static_cast<py::ssize_t>(n)));
+        if (result.is_none())
+            throw py::value_error("readinto() returned None; non-blocking streams are not supported");
+        return result.cast<size_t>();
+    }
+
+    size_t readChunk(char* dst, size_t n)
+    {
+        while (mChunkLeft == 0) {
+            if (!mChunks)
+                return 0;
+            py::object chunk = py::reinterpret_steal<py::object>(PyIter_Next(mChunks.ptr()));
+            if (!chunk) {
+                if (PyErr_Occurred())
+                    throw py::error_already_set();
+                mChunks = py::object();
+                return 0;
+            }
+            setChunk(chunk);
+        }
+        const size_t step = std::min(n, mChunkLeft);
+        std::memcpy(dst, mChunkData, step);
+        mChunkData += step;
+        mChunkLeft -= step;
+        return step;
+    }
+
+    void setChunk(py::handle chunk)
+    {
+        if (!py::isinstance<py::buffer>(chunk))
+            throw py::type_error("stream chunks must be bytes-like objects");
+        mChunk = py::reinterpret_borrow<py::buffer>(chunk).request();
+        if (mChunk.ndim > 1 || (mChunk.ndim == 1 && mChunk.strides[0] != mChunk.itemsize))
+            throw py::value_error("stream chunks must be contiguous");
+        mChunkData = static_cast<const char*>(mChunk.ptr);
+        mChunkLeft = static_cast<size_t>(mChunk.size * mChunk.itemsize);
+    }
+
+    py::object mReadinto;
+    py::object mChunks;
+    py::buffer_info mChunk;
+    const char* mChunkData = nullptr;
+    size_t mChunkLeft = 0;
+};
+
+// ---------------------------------------------------------------------------
+// ByteBuffer: read-only Python buffer that owns a serialized std::string, so
+// BinaryWriter output can be exposed as a memoryview without a copy.
+// ---------------------------------------------------------------------------
+struct ByteBuffer
+{
+    std::string data;
+};
+
+static py::memoryview ownedMemoryview(std::string&& data)
+{
+    py::object owner = py::cast(ByteBuffer{std::move(data)});
+    return py::memoryview(owner);
+}
+
+// Copies a contiguous bytes-like object into a std::string.
+static std::string bufferToString(py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (info.ndim > 1 || (info.ndim == 1 && info.strides[0] != info.itemsize))
+        throw py::value_error("expected a contiguous bytes-like object");
+    return std::string(static_cast<const char*>(info.ptr),
+                       static_cast<size_t>(info.size * info.itemsize));
+}
+
+// Writes all of [data, data + size) to `fd`, retrying short writes and EINTR.
+static void writeAll(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = ::write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "write() failed");
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+}
+
+// Calls writer.write() until all of `view` has been accepted.  Raw (unbuffered)
+// streams may take less than offered; buffered ones return None or the length.
+static void writeAll(py::handle writer, py::memoryview view)
+{
+    py::object write = writer.attr("write");
+    size_t left = static_cast<size_t>(py::len(view));
+    size_t offset = 0;
+    while (left > 0) {
+        py::object chunk = view;
+        if (offset)
+            chunk = view[py::slice(static_cast<py::ssize_t>(offset),
+                                   static_cast<py::ssize_t>(offset + left), 1)];
+        py::object n = write(chunk);
+        const size_t written = n.is_none() ? left : n.cast<size_t>();
+        if (written == 0)
+            throw py::value_error("stream write() accepted no data");
+        offset += written;
+        left -= written;
+    }
+}
+
+static uint64_t writeFrame(int fd, const EncodedFrame& frame)
+{
+    writeAll(fd, frame.head.data(), frame.head.size());
+    if (frame.manifest)
+        writeAll(fd, frame.manifest->data(), frame.manifest->size());
+    if (frame.payload)
+        writeAll(fd, frame.payload->data(), frame.payload->size());
+    return frame.size();
+}
+
+uint64_t writeFrameToStream(py::handle writer, std::string&& manifest, std::string&& payload,
+                            int level, uint64_t chunkSize)
+{
+    EncodedFrame frame;
+    {
+        py::gil_scoped_release release;
+        frame = encodeFrame(manifest, payload, level, chunkSize);
+    }
+    const uint64_t size = frame.size();
+    writeAll(writer, ownedMemoryview(std::move(frame.head)));
+    if (frame.manifest)
+        writeAll(writer, ownedMemoryview(std::move(manifest)));
+    if (frame.payload)
+        writeAll(writer, ownedMemoryview(std::move(payload)));
+    return size;
+}
+
+// Appends `size` bytes from `chunks` to `body`, growing it at most
+// kReadStep at a time, so sizes taken from a corrupt frame cannot allocate
+// much more than the stream actually delivers.  Returns false if the stream
+// ends first.
+static bool appendFromSource(ChunkSource& chunks, std::string& body, uint64_t size)
+{
+    constexpr uint64_t kReadStep = uint64_t(64) << 20;
+    while (size > 0) {
+        const size_t step = static_cast<size_t>(std::min(size, kReadStep));
+        const size_t at = body.size();
+        body.resize(at + step);
+        if (chunks.read(&body[at], step) != step)
+            return false;
+        size -= step;
+    }
+    return true;
+}
+
+// Reads the rest of a compressed frame (its chunk table and chunks) from
+// `chunks` into `body`.  Returns false if the stream ends first.
+static bool readCompressedBody(ChunkSource& chunks, const FrameHeader& header, std::string& body)
+{
+    body.clear();
+    if (!appendFromSource(chunks, body, 8))
+        return false;
+    const auto getU64 = [&body](size_t at) {
+        return frame_detail::getLE(reinterpret_cast<const unsigned char*>(body.data()) + at, 8);
+    };
+    const uint64_t count = frameChunkCount(header, getU64(0));
+    if (count > (SIZE_MAX - 8) / 8)
+        throw std::runtime_error("corrupt RDL binary stream: chunk table too large");
+    const size_t tableSize = 8 + 8 * count;
+    if (!appendFromSource(chunks, body, tableSize - 8))
+        return false;
+    uint64_t size = tableSize;
+    for (uint64_t i = 0; i < count; ++i) {
+        const uint64_t chunk = getU64(8 + 8 * i);
+        if (chunk > SIZE_MAX - size)
+            throw std::runtime_error("corrupt RDL binary stream: compressed chunk sizes overflow");
+        size += chunk;
+    }
+    return appendFromSource(chunks, body, size - tableSize);
+}
+
+// Reads framed (manifest, payload) pairs from `source` and applies each to
+// the reader's context as soon as it is complete (see stream_format.h).
+// Only one frame is held in memory at a time.  Returns the frame count.
+static size_t fromStream(BoundBinaryReader& self, py::object source)
+{
+    ProfileScope profile(Probe::BinaryReaderFromStream);
+    ChunkSource chunks(source);
+    std::string manifest, payload, body;
+    char headerBytes[kFrameHeaderSize];
+    size_t frames = 0;
+    while (true) {
+        const size_t got = chunks.read(headerBytes, kFrameHeaderSize);
+        if (got == 0)
+            break;
+        if (got < kFrameHeaderSize)
+            throw std::runtime_error("truncated RDL binary stream: incomplete frame header");
+        const FrameHeader header = decodeFrameHeader(headerBytes);
+        bool complete;
+        if (header.compressed()) {
+            complete = readCompressedBody(chunks, header, body);
+        } else {
+            manifest.clear();
+            payload.clear();
+            complete = appendFromSource(chunks, manifest, header.manifestSize) &&
+                       appendFromSource(chunks, payload, header.payloadSize);
+        }
+        if (!complete)
+            throw std::runtime_error("truncated RDL binary stream: frame " +
+                                  std::to_string(frames) + " is incomplete");
+        {
+            InvalidateSceneIndexOnExit invalidate(self.getContext());
+            py::gil_scoped_release release;
+            if (header.compressed())
+                decodeFrameBody(header, body.data(), body.size(), manifest, payload);
+            self.fromBytes(manifest, payload);
+        }
+        profile.addBytes(header.compressed() ? kFrameHeaderSize + body.size() : header.frameSize());
+        ++frames;
+    }
+    return frames;
+}
+
+// Decodes frames of a framed-stream file (not an .rdlb file) straight from a
+// read-only mapping.  Only the selected frames (all if `frames` is None) are
+// touched, in file order, and each one's pages are released once it has been
+// copied out.  Decoded frames are copied into rdl2's heap storage like any
+// other load.  Returns the number of frames applied.
+static size_t fromStreamFile(BoundBinaryReader& self, const std::string& filename,
+                             py::object frames)
+{
+    ProfileScope profile(Probe::BinaryReaderStreamFile);
+    const bool allFrames = frames.is_none();
+    std::vector<py::ssize_t> wanted;
+    if (!allFrames)
+        wanted = frames.cast<std::vector<py::ssize_t>>();
+
+    InvalidateSceneIndexOnExit invalidate(self.getContext());
+    py::gil_scoped_release release;
+    MappedFile file(filename);
+    const std::vector<FrameEntry> index = scanFrames(file.data(), file.size());
+
+    std::vector<size_t> selected;
+    if (allFrames) {
+        selected.resize(index.size());
+        std::iota(selected.begin(), selected.end(), size_t(0));
+        file.adviseSequential();
+    } else {
+        for (py::ssize_t i : wanted) {
+            if (i < 0 || static_cast<size_t>(i) >= index.size())
+                throw py::index_error("frame " + std::to_string(i) + " out of range: '" +
+                                      filename + "' has " + std::to_string(index.size()) +
+                                      " frames");
+            selected.push_back(static_cast<size_t>(i));
+        }
+        std::sort(selected.begin(), selected.end());
+        selected.erase(std::unique(selected.begin(), selected.end()), selected.end());
+    }
+
+    std::string manifest, payload;
+    for (size_t i : selected) {
+        const FrameEntry& entry = index[i];
+        // rdl2::BinaryReader only accepts std::strings, so this is the one
+        // copy (or decompression) out of the mapping.
+        decodeFrameBody(entry.header, file.data() + entry.offset + kFrameHeaderSize,
+                        entry.size - kFrameHeaderSize, manifest, payload);
+        file.release(entry.offset, entry.size);
+        self.fromBytes(manifest, payload);
+        profile.addBytes(entry.size);
+    }
+    return selected.size();
+}
+
+// (offset, manifest size, payload size) of every frame in a framed-stream file.
+static std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> frameIndex(const std::string& filename)
+{
+    py::gil_scoped_release release;
+    MappedFile file(filename);
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> result;
+    for (const FrameEntry& entry : scanFrames(file.data(), file.size()))
+        result.emplace_back(entry.offset, entry.header.manifestSize, entry.header.payloadSize);
+    return result;
+}
 
 void bind_io(py::module_& m)
 {
     // -----------------------------------------------------------------------
     // AsciiReader
     // -----------------------------------------------------------------------
-    py::class_<rdl2::AsciiReader>(m, "AsciiReader")
+    // Readers create SceneObjects, so every load marks its context's object
+    // index stale when it finishes (or fails part-way through).
+    py::class_<BoundAsciiReader>(m, "AsciiReader")
         .def(py::init<rdl2::SceneContext&>(), py::arg("context"))
-        .def("fromFile",   &rdl2::AsciiReader::fromFile, py::arg("filename"))
-        .def("fromString", &rdl2::AsciiReader::fromString,
-             py::arg("code"), py::arg("chunk_name") = "@rdla")
-        .def("setWarningsAsErrors", &rdl2::AsciiReader::setWarningsAsErrors,
+        .def("fromFile", [](BoundAsciiReader& self, const std::string& filename) {
+                InvalidateSceneIndexOnExit invalidate(self.getContext());
+                py::gil_scoped_release release;
+                self.fromFile(filename);
+             },
+             py::arg("filename"),
+             py::call_guard<ProfiledCall<Probe::AsciiReaderFromFile>>())
+        .def("fromString", [](BoundAsciiReader& self, const std::string& code,
+                              const std::string& chunkName) {
+                InvalidateSceneIndexOnExit invalidate(self.getContext());
+                py::gil_scoped_release release;
+                self.fromString(code, chunkName);
+             },
+             py::arg("code"), py::arg("chunk_name") = "@rdla",
+             py::call_guard<ProfiledCall<Probe::AsciiReaderFromString>>())
+        .def("setWarningsAsErrors", &BoundAsciiReader::setWarningsAsErrors,
              py::arg("warnings_as_errors"));
 
     // -----------------------------------------------------------------------
@@ -29,24 +381,68 @@ void bind_io(py::module_& m)
              py::arg("skip_defaults"))
         .def("setElementsPerLine",&rdl2::AsciiWriter::setElementsPerLine,
              py::arg("elements_per_line"))
-        .def("toFile",   &rdl2::AsciiWriter::toFile, py::arg("filename"))
-        .def("toString", &rdl2::AsciiWriter::toString);
+        .def("toFile",   &rdl2::AsciiWriter::toFile, py::arg("filename"),
+             py::call_guard<ProfiledCall<Probe::AsciiWriterToFile>, py::gil_scoped_release>())
+        .def("toString", &rdl2::AsciiWriter::toString,
+             py::call_guard<ProfiledCall<Probe::AsciiWriterToString>, py::gil_scoped_release>());
 
     // -----------------------------------------------------------------------
     // BinaryReader
     // -----------------------------------------------------------------------
-    py::class_<rdl2::BinaryReader>(m, "BinaryReader")
+    py::class_<BoundBinaryReader>(m, "BinaryReader")
         .def(py::init<rdl2::SceneContext&>(), py::arg("context"))
-        .def("fromFile", &rdl2::BinaryReader::fromFile,
-             py::arg("filename"))
-        .def("fromBytes", [](rdl2::BinaryReader& self, py::bytes manifest, py::bytes payload) {
-                std::string mstr = manifest;
-                std::string pstr = payload;
+        .def("fromFile", [](BoundBinaryReader& self, const std::string& filename) {
+                InvalidateSceneIndexOnExit invalidate(self.getContext());
+                py::gil_scoped_release release;
+                self.fromFile(filename);
+             },
+             py::arg("filename"),
+             py::call_guard<ProfiledCall<Probe::BinaryReaderFromFile>>())
+        .def("fromBytes", [](BoundBinaryReader& self, py::buffer manifest, py::buffer payload) {
+                ProfileScope profile(Probe::BinaryReaderFromBytes);
+                std::string mstr = bufferToString(manifest);
+                std::string pstr = bufferToString(payload);
+                profile.addBytes(mstr.size() + pstr.size());
+                InvalidateSceneIndexOnExit invalidate(self.getContext());
+                py::gil_scoped_release release;
                 self.fromBytes(mstr, pstr);
              },
              py::arg("manifest"), py::arg("payload"),
-             "Decode RDL binary from (manifest, payload) bytes objects.")
-        .def("setWarningsAsErrors", &rdl2::BinaryReader::setWarningsAsErrors,
+             "Decode RDL binary from (manifest, payload) bytes-like objects.")
+        .def("fromStream", &fromStream, py::arg("source"),
+             "Decode a framed RDL binary stream from a binary file-like object, a "
+             "bytes-like object, or an iterable of bytes-like chunks, applying "
+             "each frame as soon as it has arrived.  Compressed frames are "
+             "decompressed in parallel.  Returns the number of frames.")
+        .def("fromStreamFile", &fromStreamFile,
+             py::arg("filename"), py::arg("frames") = py::none(),
+             "Decode the frames listed in `frames` (default: all) of a framed-stream "
+             "file written by toFileDescriptor or toStream, in file order.  The "
+             "file is memory-mapped so unselected frames are never read; decoded "
+             "frames are copied into the scene as usual.  Does not read .rdlb "
+             "files.  Returns the number of frames applied.")
+        .def_static("frameIndex", &frameIndex, py::arg("filename"),
+                    "Return (offset, manifest_size, payload_size) for each frame of a "
+                    "framed-stream file, reading only the frame headers.")
+        .def_static("readIndex", &readIndex, py::arg("filename"),
+                    "Return the ArchiveEntry (object name, class name, byte offset "
+                    "and length) of every object in an RDL archive written by "
+                    "BinaryWriter.writeIndexedFile, reading only its index.")
+        .def("readObjects", [](BoundBinaryReader& self, const std::string& filename,
+                               const std::vector<std::string>& names, bool references) {
+                InvalidateSceneIndexOnExit invalidate(self.getContext());
+                py::gil_scoped_release release;
+                return readObjects(self.getContext(), filename, names, references);
+             },
+             py::arg("filename"), py::arg("names"), py::arg("references") = false,
+             "Decode only the named objects of an RDL archive into this reader's "
+             "context.  Objects they reference are created with default values "
+             "unless references=True, which decodes them from the archive too.  "
+             "Returns the number of objects decoded.")
+        .def("fromSnapshot", &readSnapshot, py::arg("name"),
+             "Decode a SceneContext.exportSnapshot() shared-memory segment into "
+             "this reader's context.")
+        .def("setWarningsAsErrors", &BoundBinaryReader::setWarningsAsErrors,
              py::arg("warnings_as_errors"))
         .def_static("showManifest", [](py::bytes manifest) {
                 std::string mstr = manifest;
@@ -58,7 +454,16 @@ void bind_io(py::module_& m)
     // -----------------------------------------------------------------------
     // BinaryWriter
     // -----------------------------------------------------------------------
-    py::class_<rdl2::BinaryWriter>(m, "BinaryWriter")
+    py::class_<ByteBuffer>(m, "ByteBuffer", py::buffer_protocol(),
+        "Owner of a serialized buffer returned by BinaryWriter.toBytes(copy=False).")
+        .def_buffer([](ByteBuffer& self) {
+            return py::buffer_info(const_cast<char*>(self.data.data()), 1, "B", 1,
+                                   {static_cast<py::ssize_t>(self.data.size())}, {1},
+                                   /*readonly=*/true);
+        })
+        .def("__len__", [](const ByteBuffer& self) { return self.data.size(); });
+
+    py::class_<BoundBinaryWriter>(m, "BinaryWriter")
         .def(py::init<const rdl2::SceneContext&>(), py::arg("context"))
         .def("setTransientEncoding", &rdl2::BinaryWriter::setTransientEncoding,
              py::arg("transient_encoding"))
@@ -69,14 +474,77 @@ void bind_io(py::module_& m)
         .def("setSplitMode", &rdl2::BinaryWriter::setSplitMode,
              py::arg("min_vector_size"))
         .def("clearSplitMode", &rdl2::BinaryWriter::clearSplitMode)
-        .def("toFile", &rdl2::BinaryWriter::toFile,
-             py::arg("filename"))
-        .def("toBytes", [](const rdl2::BinaryWriter& self) {
+        .def("toFile", &rdl2::BinaryWriter::toFile, py::arg("filename"),
+             py::call_guard<ProfiledCall<Probe::BinaryWriterToFile>, py::gil_scoped_release>())
+        .def("toBytes", [](const BoundBinaryWriter& self, bool copy) {
+                ProfileScope profile(Probe::BinaryWriterToBytes);
                 std::string manifest, payload;
-                self.toBytes(manifest, payload);
+                {
+                    py::gil_scoped_release release;
+                    self.toBytes(manifest, payload);
+                }
+                profile.addBytes(manifest.size() + payload.size());
+                if (!copy)
+                    return py::make_tuple(ownedMemoryview(std::move(manifest)),
+                                          ownedMemoryview(std::move(payload)));
                 return py::make_tuple(py::bytes(manifest), py::bytes(payload));
              },
-             "Write RDL binary and return (manifest, payload) as bytes objects.")
+             py::arg("copy") = true,
+             "Write RDL binary and return (manifest, payload) as bytes objects.  "
+             "With copy=False, return read-only memoryviews that own the "
+             "serialized buffers instead of copying them into bytes.")
+        .def("toFileDescriptor", [](const BoundBinaryWriter& self, int fd, int compression,
+                                    uint64_t chunkSize) {
+                ProfileScope profile(Probe::BinaryWriterToFd);
+                py::gil_scoped_release release;
+                std::string manifest, payload;
+                self.toBytes(manifest, payload);
+                const uint64_t written = writeFrame(fd, encodeFrame(manifest, payload,
+                                                                    compression, chunkSize));
+                profile.addBytes(written);
+                return written;
+             },
+             py::arg("fd"), py::arg("compression") = 0,
+             py::arg("chunk_size") = kDefaultChunkSize,
+             "Write one framed-stream frame (see BinaryReader.fromStream) to an "
+             "OS file descriptor.  compression=1..19 compresses the frame with "
+             "zstd at that level, in chunk_size pieces compressed in parallel.  "
+             "Returns the number of bytes written.")
+        .def("toStream", [](const BoundBinaryWriter& self, py::object writer, int compression,
+                            uint64_t chunkSize) {
+                ProfileScope profile(Probe::BinaryWriterToStream);
+                std::string manifest, payload;
+                {
+                    py::gil_scoped_release release;
+                    self.toBytes(manifest, payload);
+                }
+                const uint64_t written = writeFrameToStream(writer, std::move(manifest),
+                                                            std::move(payload), compression,
+                                                            chunkSize);
+                profile.addBytes(written);
+                return written;
+             },
+             py::arg("writer"), py::arg("compression") = 0,
+             py::arg("chunk_size") = kDefaultChunkSize,
+             "Write one framed-stream frame to a binary file-like object through "
+             "its write() method, passing memoryviews that own the serialized "
+             "buffers (no copy is made, and the writer may keep them).  "
+             "compression and chunk_size are as for toFileDescriptor.  Returns the "
+             "number of bytes written.")
+        .def("writeIndexedFile", [](const BoundBinaryWriter& self, const std::string& filename,
+                                    uint64_t dedupMinBytes) {
+                writeIndexedFile(self.getContext(), filename, dedupMinBytes);
+             },
+             py::arg("filename"), py::arg("dedup_min_bytes") = 0,
+             py::call_guard<py::gil_scoped_release>(),
+             "Write every object of this writer's context as a separately "
+             "decodable record, followed by an index, so that "
+             "BinaryReader.readIndex and readObjects can reach single objects "
+             "without reading the rest.  The set*Encoding, setSkipDefaults and "
+             "setSplitMode options do not apply.  With dedup_min_bytes > 0, "
+             "numeric vectors at least that large are stored once per distinct "
+             "content and shared between records; the other writers never "
+             "deduplicate.")
         .def("show", &rdl2::BinaryWriter::show,
              py::arg("indent") = "", py::arg("sort") = false,
              "Return a human-readable dump of the context (debug utility).");
@@ -4,6 +4,128 @@
 // Python bindings for LayerAssignment and Layer.
 
 #include "bindings.h"
+#include "update_scope.h"
+
+// ---------------------------------------------------------------------------
+// Columnar assignment table: assignMany() takes one column per
+// LayerAssignment field and exportAssignments() returns the same columns, so
+// a table can be copied between layers with assignMany(**columns).  The
+// exported 'assignment_ids' column is accepted and ignored, since the
+// target layer numbers its own assignments.
+// ---------------------------------------------------------------------------
+
+// A column is a sequence with one entry per row, a single object shared by
+// every row, or None (null in every row).
+template <typename T>
+static std::vector<T*> objectColumn(py::handle values, size_t rows, const char* name)
+{
+    if (values.is_none())
+        return std::vector<T*>(rows, nullptr);
+    if (py::isinstance<T>(values))
+        return std::vector<T*>(rows, values.cast<T*>());
+    auto column = values.cast<std::vector<T*>>();
+    if (column.size() != rows)
+        throw py::value_error(std::string("assignMany() column '") + name + "' has " +
+                              std::to_string(column.size()) + " entries, expected " +
+                              std::to_string(rows));
+    return column;
+}
+
+static py::array_t<int32_t> assignMany(rdl2::Layer& self,
+                                       py::object geometries,
+                                       const std::vector<std::string>& parts,
+                                       py::object materials,
+                                       py::object lightSets,
+                                       py::object displacements,
+                                       py::object volumeShaders,
+                                       py::object lightFilterSets,
+                                       py::object shadowSets,
+                                       py::object shadowReceiverSets,
+                                       py::object /*assignmentIds*/)
+{
+    const size_t rows = parts.size();
+    if (geometries.is_none())
+        throw py::type_error("assignMany() geometries must not be None");
+    const auto geoms    = objectColumn<rdl2::Geometry>(geometries, rows, "geometries");
+    const auto mats     = objectColumn<rdl2::Material>(materials, rows, "materials");
+    const auto lsets    = objectColumn<rdl2::LightSet>(lightSets, rows, "light_sets");
+    const auto disps    = objectColumn<rdl2::Displacement>(displacements, rows, "displacements");
+    const auto vols     = objectColumn<rdl2::VolumeShader>(volumeShaders, rows, "volume_shaders");
+    const auto lfsets   = objectColumn<rdl2::LightFilterSet>(lightFilterSets, rows, "light_filter_sets");
+    const auto ssets    = objectColumn<rdl2::ShadowSet>(shadowSets, rows, "shadow_sets");
+    const auto srsets   = objectColumn<rdl2::ShadowReceiverSet>(shadowReceiverSets, rows,
+                                                                "shadow_receiver_sets");
+    for (const rdl2::Geometry* g : geoms)
+        if (!g) throw py::type_error("assignMany() geometries must not contain None");
+
+    // The GIL stays held: it keeps other Python threads from reading the
+    // Layer while assign() reallocates its tables.
+    py::array_t<int32_t> ids(static_cast<py::ssize_t>(rows));
+    int32_t* out = ids.mutable_data();
+    {
+        UpdateScope guard(&self);
+        rdl2::LayerAssignment a;
+        for (size_t i = 0; i < rows; ++i) {
+            a.mMaterial          = mats[i];
+            a.mLightSet          = lsets[i];
+            a.mDisplacement      = disps[i];
+            a.mVolumeShader      = vols[i];
+            a.mLightFilterSet    = lfsets[i];
+            a.mShadowSet         = ssets[i];
+            a.mShadowReceiverSet = srsets[i];
+            out[i] = self.assign(geoms[i], parts[i], a);
+        }
+    }
+    return ids;
+}
+
+template <typename T>
+static py::list referenceList(const std::vector<T*>& column)
+{
+    return py::cast(column, py::return_value_policy::reference);
+}
+
+static py::dict exportAssignments(const rdl2::Layer& self)
+{
+    const size_t rows = static_cast<size_t>(self.getAssignmentCount());
+    py::array_t<int32_t> ids(static_cast<py::ssize_t>(rows));
+    std::vector<const rdl2::Geometry*>          geoms(rows);
+    std::vector<std::string>                    parts(rows);
+    std::vector<const rdl2::Material*>          mats(rows);
+    std::vector<const rdl2::LightSet*>          lsets(rows);
+    std::vector<const rdl2::Displacement*>      disps(rows);
+    std::vector<const rdl2::VolumeShader*>      vols(rows);
+    std::vector<const rdl2::LightFilterSet*>    lfsets(rows);
+    std::vector<const rdl2::ShadowSet*>         ssets(rows);
+    std::vector<const rdl2::ShadowReceiverSet*> srsets(rows);
+    int32_t* out = ids.mutable_data();
+    for (size_t i = 0; i < rows; ++i) {
+        const int32_t id = static_cast<int32_t>(i);
+        auto pair = self.lookupGeomAndPart(id);
+        out[i]    = id;
+        geoms[i]  = pair.first;
+        parts[i]  = std::string(pair.second);
+        mats[i]   = self.lookupMaterial(id);
+        lsets[i]  = self.lookupLightSet(id);
+        disps[i]  = self.lookupDisplacement(id);
+        vols[i]   = self.lookupVolumeShader(id);
+        lfsets[i] = self.lookupLightFilterSet(id);
+        ssets[i]  = self.lookupShadowSet(id);
+        srsets[i] = self.lookupShadowReceiverSet(id);
+    }
+    py::dict columns;
+    columns["assignment_ids"]       = ids;
+    columns["geometries"]           = referenceList(geoms);
+    columns["part_names"]           = py::cast(parts);
+    columns["materials"]            = referenceList(mats);
+    columns["light_sets"]           = referenceList(lsets);
+    columns["displacements"]        = referenceList(disps);
+    columns["volume_shaders"]       = referenceList(vols);
+    columns["light_filter_sets"]    = referenceList(lfsets);
+    columns["shadow_sets"]          = referenceList(ssets);
+    columns["shadow_receiver_sets"] = referenceList(srsets);
+    return columns;
+}
 
 void bind_layer(py::module_& m)
 {
@@ -34,21 +156,21 @@ void bind_layer(py::module_& m)
         }), py::arg("scene_object"))
         .def("assign", [](rdl2::Layer& self, rdl2::Geometry* g, const std::string& part,
                           rdl2::Material* mat, rdl2::LightSet* ls) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             return self.assign(g, part, mat, ls);
         }, py::arg("geometry"), py::arg("part_name"),
            py::arg("material"), py::arg("light_set"))
         .def("assign", [](rdl2::Layer& self, rdl2::Geometry* g, const std::string& part,
                           rdl2::Material* mat, rdl2::LightSet* ls,
                           rdl2::Displacement* disp, rdl2::VolumeShader* vs) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             return self.assign(g, part, mat, ls, disp, vs);
         }, py::arg("geometry"), py::arg("part_name"),
            py::arg("material"), py::arg("light_set"),
            py::arg("displacement"), py::arg("volume_shader"))
         .def("assign", [](rdl2::Layer& self, rdl2::Geometry* g, const std::string& part,
                           const rdl2::LayerAssignment& a) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             return self.assign(g, part, a);
         }, py::arg("geometry"), py::arg("part_name"), py::arg("assignment"))
         .def("lookupMaterial",         &rdl2::Layer::lookupMaterial,
@@ -65,8 +187,22 @@ void bind_layer(py::module_& m)
              py::arg("assignment_id"), py::return_value_policy::reference)
         .def("lookupShadowReceiverSet",&rdl2::Layer::lookupShadowReceiverSet,
              py::arg("assignment_id"), py::return_value_policy::reference)
+        .def("assignMany", &assignMany,
+             py::arg("geometries"), py::arg("part_names"),
+             py::arg("materials") = py::none(), py::arg("light_sets") = py::none(),
+             py::arg("displacements") = py::none(), py::arg("volume_shaders") = py::none(),
+             py::arg("light_filter_sets") = py::none(), py::arg("shadow_sets") = py::none(),
+             py::arg("shadow_receiver_sets") = py::none(),
+             py::arg("assignment_ids") = py::none(),
+             "Add one assignment per entry of `part_names` and return the IDs as an "
+             "int32 ndarray.  Every other column is a sequence of the same length, a "
+             "single object shared by all rows, or None.  `assignment_ids` is "
+             "ignored, so exportAssignments() output can be passed back as-is.")
+        .def("exportAssignments", &exportAssignments,
+             "Return the assignment table as a dict of columns keyed like the "
+             "assignMany() arguments, plus an int32 'assignment_ids' ndarray.")
         .def("clear", [](rdl2::Layer& self) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.clear();
         })
         .def("lightSetsChanged", &rdl2::Layer::lightSetsChanged);
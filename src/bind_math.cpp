@@ -3,8 +3,10 @@
 //
 // Python bindings for scene_rdl2 math types:
 //   Rgb, Rgba, Vec2f, Vec2d, Vec3f, Vec3d, Vec4f, Vec4d, Mat4f, Mat4d
+// and their bulk containers RgbArray ... Mat4dArray.
 
 #include "bindings.h"
+#include "arrays.h"
 
 // ---------------------------------------------------------------------------
 // Helpers: build a Vec4f / Vec4d from a Python object (Vec4* or sequence)
@@ -31,21 +33,68 @@ static rdl2::Vec4d to_vec4d(py::object h)
                        s[2].cast<double>(), s[3].cast<double>());
 }
 
+// ---------------------------------------------------------------------------
+// Helper: bind MathArray<V> as "<Elem>Array" — a contiguous C++-owned vector
+// of math values that converts to/from NumPy in one copy (or none).
+// ---------------------------------------------------------------------------
+template <typename V>
+static void bindMathArray(py::module_& m, const char* name)
+{
+    using Array = MathArray<V>;
+    py::class_<Array>(m, name, py::buffer_protocol())
+        .def(py::init<>())
+        .def(py::init([](py::object values) {
+            return Array{vectorFromArray<V>(values)};
+        }), py::arg("values"),
+        "Build from an ndarray, buffer or nested sequence of matching shape.")
+        .def_static("from_numpy", [](py::object array) {
+            return Array{vectorFromArray<V>(array)};
+        }, py::arg("array"),
+        "Bulk-convert an ndarray with a single copy.")
+        .def("to_numpy", [](py::object self, bool copy) -> py::array {
+            const Array& a = self.cast<const Array&>();
+            return copy ? arrayCopy(a.values) : arrayView(a.values, self, true);
+        }, py::arg("copy") = false,
+        "Return the values as an ndarray.  By default this is a writable view "
+        "sharing memory with this array; pass copy=True for an independent copy.")
+        .def_buffer([](Array& a) { return vectorBuffer(a.values); })
+        .def("__len__", [](const Array& a) { return a.values.size(); })
+        .def("__getitem__", [](const Array& a, py::ssize_t i) {
+            const py::ssize_t n = static_cast<py::ssize_t>(a.values.size());
+            if (i < 0) i += n;
+            if (i < 0 || i >= n) throw py::index_error("index out of range");
+            return a.values[i];
+        }, py::arg("index"))
+        .def("__setitem__", [](Array& a, py::ssize_t i, const typename V::value_type& v) {
+            const py::ssize_t n = static_cast<py::ssize_t>(a.values.size());
+            if (i < 0) i += n;
+            if (i < 0 || i >= n) throw py::index_error("index out of range");
+            a.values[i] = v;
+        }, py::arg("index"), py::arg("value"))
+        .def("tolist", [](const Array& a) { return a.values; })
+        .def("__repr__", [name](const Array& a) {
+            return std::string(name) + "(len=" + std::to_string(a.values.size()) + ")";
+        });
+}
+
 void bind_math(py::module_& m)
 {
     // -----------------------------------------------------------------------
     // Rgb (Col3f): r, g, b
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Rgb>(m, "Rgb")
+    py::class_<rdl2::Rgb>(m, "Rgb", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<float>(), py::arg("v"))
         .def(py::init<float, float, float>(), py::arg("r"), py::arg("g"), py::arg("b"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Rgb>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 3)
                 throw py::value_error("Rgb requires 3 elements, got " +
                                       std::to_string(py::len(s)));
             return rdl2::Rgb(s[0].cast<float>(), s[1].cast<float>(), s[2].cast<float>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Rgb>)
         .def_readwrite("r", &rdl2::Rgb::r)
         .def_readwrite("g", &rdl2::Rgb::g)
         .def_readwrite("b", &rdl2::Rgb::b)
@@ -65,11 +114,13 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Rgba (Col4f): r, g, b, a
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Rgba>(m, "Rgba")
+    py::class_<rdl2::Rgba>(m, "Rgba", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<float>(), py::arg("v"))
         .def(py::init<float, float, float, float>(),
              py::arg("r"), py::arg("g"), py::arg("b"), py::arg("a"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Rgba>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 4)
                 throw py::value_error("Rgba requires 4 elements, got " +
@@ -77,6 +128,7 @@ void bind_math(py::module_& m)
             return rdl2::Rgba(s[0].cast<float>(), s[1].cast<float>(),
                               s[2].cast<float>(), s[3].cast<float>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Rgba>)
         .def_readwrite("r", &rdl2::Rgba::r)
         .def_readwrite("g", &rdl2::Rgba::g)
         .def_readwrite("b", &rdl2::Rgba::b)
@@ -94,16 +146,19 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec2f
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec2f>(m, "Vec2f")
+    py::class_<rdl2::Vec2f>(m, "Vec2f", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<float>(), py::arg("v"))
         .def(py::init<float, float>(), py::arg("x"), py::arg("y"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec2f>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 2)
                 throw py::value_error("Vec2f requires 2 elements, got " +
                                       std::to_string(py::len(s)));
             return rdl2::Vec2f(s[0].cast<float>(), s[1].cast<float>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec2f>)
         .def_readwrite("x", &rdl2::Vec2f::x)
         .def_readwrite("y", &rdl2::Vec2f::y)
         .def("__repr__", [](const rdl2::Vec2f& v) {
@@ -118,16 +173,19 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec2d
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec2d>(m, "Vec2d")
+    py::class_<rdl2::Vec2d>(m, "Vec2d", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<double>(), py::arg("v"))
         .def(py::init<double, double>(), py::arg("x"), py::arg("y"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec2d>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 2)
                 throw py::value_error("Vec2d requires 2 elements, got " +
                                       std::to_string(py::len(s)));
             return rdl2::Vec2d(s[0].cast<double>(), s[1].cast<double>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec2d>)
         .def_readwrite("x", &rdl2::Vec2d::x)
         .def_readwrite("y", &rdl2::Vec2d::y)
         .def("__repr__", [](const rdl2::Vec2d& v) {
@@ -139,16 +197,19 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec3f
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec3f>(m, "Vec3f")
+    py::class_<rdl2::Vec3f>(m, "Vec3f", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<float>(), py::arg("v"))
         .def(py::init<float, float, float>(), py::arg("x"), py::arg("y"), py::arg("z"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec3f>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 3)
                 throw py::value_error("Vec3f requires 3 elements, got " +
                                       std::to_string(py::len(s)));
             return rdl2::Vec3f(s[0].cast<float>(), s[1].cast<float>(), s[2].cast<float>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec3f>)
         .def_readwrite("x", &rdl2::Vec3f::x)
         .def_readwrite("y", &rdl2::Vec3f::y)
         .def_readwrite("z", &rdl2::Vec3f::z)
@@ -168,16 +229,19 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec3d
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec3d>(m, "Vec3d")
+    py::class_<rdl2::Vec3d>(m, "Vec3d", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<double>(), py::arg("v"))
         .def(py::init<double, double, double>(), py::arg("x"), py::arg("y"), py::arg("z"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec3d>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 3)
                 throw py::value_error("Vec3d requires 3 elements, got " +
                                       std::to_string(py::len(s)));
             return rdl2::Vec3d(s[0].cast<double>(), s[1].cast<double>(), s[2].cast<double>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec3d>)
         .def_readwrite("x", &rdl2::Vec3d::x)
         .def_readwrite("y", &rdl2::Vec3d::y)
         .def_readwrite("z", &rdl2::Vec3d::z)
@@ -191,11 +255,13 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec4f
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec4f>(m, "Vec4f")
+    py::class_<rdl2::Vec4f>(m, "Vec4f", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<float>(), py::arg("v"))
         .def(py::init<float, float, float, float>(),
              py::arg("x"), py::arg("y"), py::arg("z"), py::arg("w"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec4f>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 4)
                 throw py::value_error("Vec4f requires 4 elements, got " +
@@ -203,6 +269,7 @@ void bind_math(py::module_& m)
             return rdl2::Vec4f(s[0].cast<float>(), s[1].cast<float>(),
                                s[2].cast<float>(), s[3].cast<float>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec4f>)
         .def_readwrite("x", &rdl2::Vec4f::x)
         .def_readwrite("y", &rdl2::Vec4f::y)
         .def_readwrite("z", &rdl2::Vec4f::z)
@@ -217,11 +284,13 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Vec4d
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Vec4d>(m, "Vec4d")
+    py::class_<rdl2::Vec4d>(m, "Vec4d", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<double>(), py::arg("v"))
         .def(py::init<double, double, double, double>(),
              py::arg("x"), py::arg("y"), py::arg("z"), py::arg("w"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Vec4d>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence s) {
             if (py::len(s) != 4)
                 throw py::value_error("Vec4d requires 4 elements, got " +
@@ -229,6 +298,7 @@ void bind_math(py::module_& m)
             return rdl2::Vec4d(s[0].cast<double>(), s[1].cast<double>(),
                                s[2].cast<double>(), s[3].cast<double>());
         }), py::arg("s"))
+        .def_buffer(&valueBuffer<rdl2::Vec4d>)
         .def_readwrite("x", &rdl2::Vec4d::x)
         .def_readwrite("y", &rdl2::Vec4d::y)
         .def_readwrite("z", &rdl2::Vec4d::z)
@@ -245,10 +315,12 @@ void bind_math(py::module_& m)
     // Accepts: Mat4f(Vec4f, Vec4f, Vec4f, Vec4f)
     //          Mat4f([[r,r,r,r], [r,r,r,r], [r,r,r,r], [r,r,r,r]])
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Mat4f>(m, "Mat4f")
+    py::class_<rdl2::Mat4f>(m, "Mat4f", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<rdl2::Vec4f, rdl2::Vec4f, rdl2::Vec4f, rdl2::Vec4f>(),
              py::arg("vx"), py::arg("vy"), py::arg("vz"), py::arg("vw"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Mat4f>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence rows) {
             if (py::len(rows) != 4)
                 throw py::value_error("Mat4f requires 4 rows, got " +
@@ -256,6 +328,7 @@ void bind_math(py::module_& m)
             return rdl2::Mat4f(to_vec4f(rows[0]), to_vec4f(rows[1]),
                                to_vec4f(rows[2]), to_vec4f(rows[3]));
         }), py::arg("rows"))
+        .def_buffer(&valueBuffer<rdl2::Mat4f>)
         .def_readwrite("vx", &rdl2::Mat4f::vx)
         .def_readwrite("vy", &rdl2::Mat4f::vy)
         .def_readwrite("vz", &rdl2::Mat4f::vz)
@@ -270,10 +343,12 @@ void bind_math(py::module_& m)
     // -----------------------------------------------------------------------
     // Mat4d (vx, vy, vz, vw are Vec4d rows)
     // -----------------------------------------------------------------------
-    py::class_<rdl2::Mat4d>(m, "Mat4d")
+    py::class_<rdl2::Mat4d>(m, "Mat4d", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<rdl2::Vec4d, rdl2::Vec4d, rdl2::Vec4d, rdl2::Vec4d>(),
              py::arg("vx"), py::arg("vy"), py::arg("vz"), py::arg("vw"))
+        .def(py::init([](py::buffer b) { return valueFromArray<rdl2::Mat4d>(b); }),
+             py::arg("array"))
         .def(py::init([](py::sequence rows) {
             if (py::len(rows) != 4)
                 throw py::value_error("Mat4d requires 4 rows, got " +
@@ -281,6 +356,7 @@ void bind_math(py::module_& m)
             return rdl2::Mat4d(to_vec4d(rows[0]), to_vec4d(rows[1]),
                                to_vec4d(rows[2]), to_vec4d(rows[3]));
         }), py::arg("rows"))
+        .def_buffer(&valueBuffer<rdl2::Mat4d>)
         .def_readwrite("vx", &rdl2::Mat4d::vx)
         .def_readwrite("vy", &rdl2::Mat4d::vy)
         .def_readwrite("vz", &rdl2::Mat4d::vz)
@@ -291,4 +367,19 @@ void bind_math(py::module_& m)
         });
     py::implicitly_convertible<py::list,  rdl2::Mat4d>();
     py::implicitly_convertible<py::tuple, rdl2::Mat4d>();
+
+    // -----------------------------------------------------------------------
+    // Bulk containers (buffer protocol, NumPy round-trips without per-element
+    // Python objects)
+    // -----------------------------------------------------------------------
+    bindMathArray<rdl2::RgbVector>  (m, "RgbArray");
+    bindMathArray<rdl2::RgbaVector> (m, "RgbaArray");
+    bindMathArray<rdl2::Vec2fVector>(m, "Vec2fArray");
+    bindMathArray<rdl2::Vec2dVector>(m, "Vec2dArray");
+    bindMathArray<rdl2::Vec3fVector>(m, "Vec3fArray");
+    bindMathArray<rdl2::Vec3dVector>(m, "Vec3dArray");
+    bindMathArray<rdl2::Vec4fVector>(m, "Vec4fArray");
+    bindMathArray<rdl2::Vec4dVector>(m, "Vec4dArray");
+    bindMathArray<rdl2::Mat4fVector>(m, "Mat4fArray");
+    bindMathArray<rdl2::Mat4dVector>(m, "Mat4dArray");
 }
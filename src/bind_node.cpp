@@ -4,6 +4,7 @@
 // Python bindings for Node, Camera, and Geometry (the Node sub-hierarchy).
 
 #include "bindings.h"
+#include "update_scope.h"
 
 void bind_node(py::module_& m)
 {
@@ -22,7 +23,7 @@ void bind_node(py::module_& m)
             return self.get(rdl2::Node::sNodeXformKey);
         }, "Returns the node transform matrix (Mat4d).")
         .def("setNodeXform", [](rdl2::Node& self, const rdl2::Mat4d& xform) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.set(rdl2::Node::sNodeXformKey, xform);
         }, py::arg("xform"), "Sets the node transform matrix.");
 
@@ -48,11 +49,11 @@ void bind_node(py::module_& m)
             return self.get(rdl2::Camera::sFarKey);
         })
         .def("setNear", [](rdl2::Camera& self, float near) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setNear(near);
         }, py::arg("near"))
         .def("setFar", [](rdl2::Camera& self, float far) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setFar(far);
         }, py::arg("far"));
 
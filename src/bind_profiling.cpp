@@ -0,0 +1,218 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// scene_rdl2.profiling: counters behind ProfileScope (profiling.h) and their
+// Python interface.
+//
+// Every thread that records gets its own counter block, written only by that
+// thread with relaxed atomics so readers on other threads see whole values
+// without any locking on the recording path.  Blocks register themselves on
+// first use and fold their totals into sRetired when their thread exits.
+
+#include "bindings.h"
+#include "profiling.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <mutex>
+
+std::atomic<bool> gProfilingEnabled{false};
+
+static const char* const kProbeNames[] = {
+#define SCENE_RDL2_PROBE_NAME(id, name) name,
+    SCENE_RDL2_PROBES(SCENE_RDL2_PROBE_NAME)
+#undef SCENE_RDL2_PROBE_NAME
+};
+
+struct ProbeTotals
+{
+    uint64_t calls = 0;
+    uint64_t nanos = 0;
+    uint64_t bytes = 0;
+};
+
+using Totals = std::array<ProbeTotals, kProbeCount>;
+
+struct ProbeCounters
+{
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> nanos{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+// Single-writer increment: cheaper than fetch_add, still tear-free to readers.
+static void bump(std::atomic<uint64_t>& counter, uint64_t amount)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+class ThreadCounters;
+
+static std::mutex sRegistryMutex;
+static std::vector<ThreadCounters*> sThreads;
+static Totals sRetired;
+
+class ThreadCounters
+{
+public:
+    ThreadCounters()
+    {
+        std::lock_guard<std::mutex> lock(sRegistryMutex);
+        sThreads.push_back(this);
+    }
+    ~ThreadCounters()
+    {
+        std::lock_guard<std::mutex> lock(sRegistryMutex);
+        addTo(sRetired);
+        sThreads.erase(std::find(sThreads.begin(), sThreads.end(), this));
+    }
+
+    void record(Probe probe, uint64_t nanos, uint64_t bytes)
+    {
+        ProbeCounters& c = mCounters[static_cast<size_t>(probe)];
+        bump(c.calls, 1);
+        bump(c.nanos, nanos);
+        if (bytes)
+            bump(c.bytes, bytes);
+    }
+
+    void addTo(Totals& totals) const
+    {
+        for (size_t i = 0; i < kProbeCount; ++i) {
+            totals[i].calls += mCounters[i].calls.load(std::memory_order_relaxed);
+            totals[i].nanos += mCounters[i].nanos.load(std::memory_order_relaxed);
+            totals[i].bytes += mCounters[i].bytes.load(std::memory_order_relaxed);
+        }
+    }
+
+    void clear()
+    {
+        for (ProbeCounters& c : mCounters) {
+            c.calls.store(0, std::memory_order_relaxed);
+            c.nanos.store(0, std::memory_order_relaxed);
+            c.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::array<ProbeCounters, kProbeCount> mCounters;
+};
+
+void recordProfile(Probe probe, uint64_t nanos, uint64_t bytes)
+{
+    static thread_local ThreadCounters sCounters;
+    sCounters.record(probe, nanos, bytes);
+}
+
+static Totals collectTotals()
+{
+    std::lock_guard<std::mutex> lock(sRegistryMutex);
+    Totals totals = sRetired;
+    for (const ThreadCounters* counters : sThreads)
+        counters->addTo(totals);
+    return totals;
+}
+
+// Counts recorded concurrently with reset() by other threads may survive it.
+static void resetTotals()
+{
+    std::lock_guard<std::mutex> lock(sRegistryMutex);
+    sRetired = Totals();
+    for (ThreadCounters* counters : sThreads)
+        counters->clear();
+}
+
+// Probes that recorded at least one call, slowest first.
+static std::vector<size_t> activeProbes(const Totals& totals)
+{
+    std::vector<size_t> order;
+    for (size_t i = 0; i < kProbeCount; ++i)
+        if (totals[i].calls)
+            order.push_back(i);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return totals[a].nanos > totals[b].nanos;
+    });
+    return order;
+}
+
+static py::dict getStats()
+{
+    const Totals totals = collectTotals();
+    py::dict stats;
+    for (size_t i : activeProbes(totals)) {
+        py::dict entry;
+        entry["calls"]  = totals[i].calls;
+        entry["time_s"] = totals[i].nanos * 1e-9;
+        entry["bytes"]  = totals[i].bytes;
+        stats[kProbeNames[i]] = entry;
+    }
+    return stats;
+}
+
+static std::string formatTable(const Totals& totals)
+{
+    std::string out;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-32s %12s %14s %12s %14s\n",
+                  "binding", "calls", "total ms", "avg us", "bytes");
+    out += line;
+    for (size_t i : activeProbes(totals)) {
+        const ProbeTotals& t = totals[i];
+        std::snprintf(line, sizeof(line), "%-32s %12llu %14.3f %12.3f %14llu\n",
+                      kProbeNames[i], static_cast<unsigned long long>(t.calls),
+                      t.nanos * 1e-6, t.nanos * 1e-3 / t.calls,
+                      static_cast<unsigned long long>(t.bytes));
+        out += line;
+    }
+    return out;
+}
+
+static std::string formatJson(const Totals& totals)
+{
+    std::string out = "{";
+    bool first = true;
+    char entry[256];
+    for (size_t i : activeProbes(totals)) {
+        std::snprintf(entry, sizeof(entry),
+                      "%s\n  \"%s\": {\"calls\": %llu, \"time_s\": %.9f, \"bytes\": %llu}",
+                      first ? "" : ",", kProbeNames[i],
+                      static_cast<unsigned long long>(totals[i].calls),
+                      totals[i].nanos * 1e-9,
+                      static_cast<unsigned long long>(totals[i].bytes));
+        out += entry;
+        first = false;
+    }
+    out += first ? "}" : "\n}";
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// bind_profiling
+// ---------------------------------------------------------------------------
+void bind_profiling(py::module_& m)
+{
+    py::module_ prof = m.def_submodule("profiling",
+        "Opt-in per-binding call counts, cumulative C++ time and bytes converted.  "
+        "Costs one atomic load per instrumented call while disabled.");
+
+    prof.def("enable", []() { gProfilingEnabled.store(true); },
+             "Start recording.  Counters accumulate until reset().");
+    prof.def("disable", []() { gProfilingEnabled.store(false); });
+    prof.def("isEnabled", []() { return gProfilingEnabled.load(); });
+    prof.def("reset", &resetTotals, "Zero every counter.");
+    prof.def("getStats", &getStats,
+             "Return {binding: {'calls', 'time_s', 'bytes'}} for every binding "
+             "called while enabled, summed over all threads.  Times are inclusive "
+             "of nested bindings.");
+    prof.def("report", [](const std::string& format) {
+                const Totals totals = collectTotals();
+                if (format == "table")
+                    return formatTable(totals);
+                if (format == "json")
+                    return formatJson(totals);
+                throw py::value_error("report() format must be 'table' or 'json'");
+             },
+             py::arg("format") = "table",
+             "Return the statistics as a text table (slowest first) or a JSON string.");
+}
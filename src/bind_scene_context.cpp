@@ -4,13 +4,141 @@
 // Python bindings for SceneContext.
 
 #include "bindings.h"
+#include "attribute_handle.h"
+#include "context_io.h"
+#include "update_scope.h"
+
+#include <fnmatch.h>
+
+#include <memory>
+#include <unordered_map>
+
+// ---------------------------------------------------------------------------
+// Scene object index: per-context object lists, built lazily on first use
+// and rebuilt after invalidateSceneIndex(ctx).  Lists are shared, immutable
+// snapshots, so iterators stay valid across a rebuild.  SceneObjects are
+// never destroyed before their context, so the pointers cannot dangle.
+// ---------------------------------------------------------------------------
+using ObjectList = std::vector<rdl2::SceneObject*>;
+using ObjectListPtr = std::shared_ptr<const ObjectList>;
+
+struct SceneIndex
+{
+    uint64_t generation = 0;       // bumped by invalidateSceneIndex()
+    uint64_t builtGeneration = 0;  // the generation the lists below reflect
+    ObjectListPtr all;
+    std::unordered_map<uint32_t, ObjectListPtr> byInterface;
+    std::unordered_map<std::string, ObjectListPtr> byClass;
+};
+
+// Requires the GIL, which serializes access to the index map.  Contexts are
+// never deleted (see the py::nodelete holder below), so entries never go
+// stale by address reuse.
+static SceneIndex& sceneIndexEntry(const rdl2::SceneContext& ctx)
+{
+    static std::unordered_map<const rdl2::SceneContext*, SceneIndex> sIndices;
+    return sIndices[&ctx];
+}
+
+void invalidateSceneIndex(const rdl2::SceneContext& ctx)
+{
+    ++sceneIndexEntry(ctx).generation;
+}
+
+static SceneIndex& getSceneIndex(rdl2::SceneContext& ctx)
+{
+    SceneIndex& index = sceneIndexEntry(ctx);
+    if (!index.all || index.builtGeneration != index.generation) {
+        auto all = std::make_shared<ObjectList>();
+        for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+            all->push_back(it->second);
+        index.all = std::move(all);
+        index.byInterface.clear();
+        index.byClass.clear();
+        index.builtGeneration = index.generation;
+    }
+    return index;
+}
+
+static ObjectListPtr objectsWithInterface(SceneIndex& index, rdl2::SceneObjectInterface iface)
+{
+    ObjectListPtr& list = index.byInterface[static_cast<uint32_t>(iface)];
+    if (!list) {
+        auto result = std::make_shared<ObjectList>();
+        for (rdl2::SceneObject* obj : *index.all)
+            if (obj->getType() & iface)
+                result->push_back(obj);
+        list = std::move(result);
+    }
+    return list;
+}
+
+static ObjectListPtr objectsOfClass(SceneIndex& index, const std::string& className)
+{
+    ObjectListPtr& list = index.byClass[className];
+    if (!list) {
+        auto result = std::make_shared<ObjectList>();
+        for (rdl2::SceneObject* obj : *index.all)
+            if (obj->getSceneClass().getName() == className)
+                result->push_back(obj);
+        list = std::move(result);
+    }
+    return list;
+}
+
+// Python iterator over an index snapshot, applying any filters the snapshot
+// was not already narrowed by.
+class SceneObjectIterator
+{
+public:
+    SceneObjectIterator(ObjectListPtr objects, uint32_t interfaceMask, std::string nameGlob)
+        : mObjects(std::move(objects)), mInterfaceMask(interfaceMask),
+          mNameGlob(std::move(nameGlob)) {}
+
+    rdl2::SceneObject* next()
+    {
+        while (mPos < mObjects->size()) {
+            rdl2::SceneObject* obj = (*mObjects)[mPos++];
+            if (mInterfaceMask && !(obj->getType() & mInterfaceMask))
+                continue;
+            if (!mNameGlob.empty() && fnmatch(mNameGlob.c_str(), obj->getName().c_str(), 0) != 0)
+                continue;
+            return obj;
+        }
+        throw py::stop_iteration();
+    }
+
+private:
+    ObjectListPtr mObjects;
+    uint32_t mInterfaceMask;
+    std::string mNameGlob;
+    size_t mPos = 0;
+};
+
+static SceneObjectIterator iterSceneObjects(rdl2::SceneContext& ctx,
+                                            py::object interface,
+                                            py::object className,
+                                            py::object nameGlob)
+{
+    SceneIndex& index = getSceneIndex(ctx);
+    uint32_t mask = 0;
+    ObjectListPtr objects;
+    if (!className.is_none()) {
+        objects = objectsOfClass(index, className.cast<std::string>());
+        if (!interface.is_none())
+            mask = static_cast<uint32_t>(interface.cast<rdl2::SceneObjectInterface>());
+    } else if (!interface.is_none()) {
+        objects = objectsWithInterface(index, interface.cast<rdl2::SceneObjectInterface>());
+    } else {
+        objects = index.all;
+    }
+    return SceneObjectIterator(std::move(objects), mask,
+                               nameGlob.is_none() ? std::string() : nameGlob.cast<std::string>());
+}
 
 static std::vector<rdl2::SceneObject*> getAllSceneObjects(rdl2::SceneContext& ctx)
 {
-    std::vector<rdl2::SceneObject*> result;
-    for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
-        result.push_back(it->second);
-    return result;
+    return *getSceneIndex(ctx).all;
 }
 
 static std::vector<const rdl2::SceneClass*> getAllSceneClasses(const rdl2::SceneContext& ctx)
@@ -21,8 +149,51 @@ static std::vector<const rdl2::SceneClass*> getAllSceneClasses(const rdl2::Scene
     return result;
 }
 
+// ---------------------------------------------------------------------------
+// Bulk attribute access: one attribute on many objects, resolved once per
+// SceneClass, with the per-object loop in C++ and the GIL released.
+// ---------------------------------------------------------------------------
+// With no objects there is no class to resolve `name` against.  Guessing
+// one from the loaded classes would depend on their order, so the result is
+// typed by `className` when the caller names one, and is a plain empty list
+// otherwise.
+static py::object getMany(rdl2::SceneContext& ctx,
+                          const std::vector<rdl2::SceneObject*>& objects,
+                          const std::string& name,
+                          rdl2::AttributeTimestep ts,
+                          py::object className)
+{
+    ProfileScope profile(Probe::GetMany);
+    if (objects.empty()) {
+        if (className.is_none())
+            return py::list();
+        const rdl2::SceneClass* sc = ctx.getSceneClass(className.cast<std::string>());
+        return getAttributeHandle(*sc, name)->getMany(objects, {}, ts);
+    }
+    const std::vector<const AttributeHandle*> handles = resolveAttributeHandles(objects, name);
+    return handles.front()->getMany(objects, handles, ts);
+}
+
+static void setMany(rdl2::SceneContext&,
+                    const std::vector<rdl2::SceneObject*>& objects,
+                    const std::string& name,
+                    py::object values,
+                    rdl2::AttributeTimestep ts)
+{
+    ProfileScope profile(Probe::SetMany);
+    if (objects.empty())
+        return;
+    const std::vector<const AttributeHandle*> handles = resolveAttributeHandles(objects, name);
+    handles.front()->setMany(objects, handles, values, ts);
+}
+
 void bind_scene_context(py::module_& m)
 {
+    py::class_<SceneObjectIterator>(m, "SceneObjectIterator")
+        .def("__iter__", [](SceneObjectIterator& self) -> SceneObjectIterator& { return self; },
+             py::return_value_policy::reference_internal)
+        .def("__next__", &SceneObjectIterator::next, py::return_value_policy::reference);
+
     // py::nodelete prevents pybind11 from calling ~SceneContext(), which aborts
     // outside the full MoonRay pipeline. Memory is reclaimed by the OS on exit.
     py::class_<rdl2::SceneContext, std::unique_ptr<rdl2::SceneContext, py::nodelete>>(m, "SceneContext")
@@ -63,11 +234,63 @@ void bind_scene_context(py::module_& m)
              &rdl2::SceneContext::getSceneObject,
              py::return_value_policy::reference)
         .def("sceneObjectExists", &rdl2::SceneContext::sceneObjectExists)
-        .def("createSceneObject", &rdl2::SceneContext::createSceneObject,
-             py::return_value_policy::reference)
+        .def("createSceneObject", [](rdl2::SceneContext& self, const std::string& className,
+                                     const std::string& objectName) {
+            invalidateSceneIndex(self);
+            return self.createSceneObject(className, objectName);
+        }, py::arg("class_name"), py::arg("object_name"),
+           py::return_value_policy::reference)
         .def("getAllSceneObjects", &getAllSceneObjects,
              py::return_value_policy::reference,
              "Returns a list of all SceneObject instances in the context.")
+        .def("iterSceneObjects", &iterSceneObjects,
+             py::arg("interface") = py::none(), py::arg("class_name") = py::none(),
+             py::arg("name_glob") = py::none(),
+             "Iterates the SceneObjects matching every given filter: any bit of "
+             "`interface`, exact SceneClass name `class_name`, and fnmatch-style "
+             "`name_glob`.  Backed by a cached per-context index.")
+        // Bulk attribute access
+        .def("getMany", &getMany,
+             py::arg("objects"), py::arg("attr_name"),
+             py::arg("timestep") = rdl2::TIMESTEP_BEGIN, py::arg("class_name") = py::none(),
+             "Returns attribute `attr_name` of every object in `objects`: an ndarray "
+             "for numeric and math types, otherwise a list.  For no objects the "
+             "result is an empty list, or, if `class_name` is given, empty with the "
+             "type that SceneClass declares for `attr_name`.  Reads without the GIL: "
+             "other threads must not modify the objects during the call.")
+        .def("setMany", &setMany,
+             py::arg("objects"), py::arg("attr_name"), py::arg("values"),
+             py::arg("timestep") = rdl2::TIMESTEP_BEGIN,
+             "Sets attribute `attr_name` on every object in `objects` from `values` "
+             "(a sequence or ndarray with one entry per object).  Writes without "
+             "the GIL: other threads must not read or modify the objects during "
+             "the call.")
+        .def("hashAll", &hashAll,
+             py::arg("include_bindings") = true, py::arg("recursive") = false,
+             "Returns {name: SceneObject.contentHash(...)} for every object, "
+             "hashing in parallel.")
+        .def("memoryReport", &memoryReport, py::arg("group_by") = "class",
+             "Returns {group: bytes} summing SceneObject.memoryUsage() over every "
+             "object, largest first.  `group_by` is 'class', 'attribute_type' "
+             "or 'object'.")
+        .def("dependencyGraph", &dependencyGraph,
+             "Build the DependencyGraph of every object: bindings, SceneObject "
+             "attributes, set members and Layer assignments, as CSR arrays.")
+        .def("batchUpdate", [](rdl2::SceneContext&, std::vector<rdl2::SceneObject*> objects) {
+            return UpdateBlock(std::move(objects));
+        }, py::arg("objects"),
+           "Context manager holding every object in `objects` open for update "
+           "for the duration of the block.")
+        // Shared-memory snapshots
+        .def("exportSnapshot", &exportSnapshot, py::arg("name") = py::none(),
+             "Serialize the context into a new POSIX shared-memory segment and "
+             "return its SceneSnapshot.  With no `name`, a unique one is chosen.")
+        .def_static("fromSnapshot", &contextFromSnapshot,
+                    py::arg("name"), py::arg("dso_path") = py::none(),
+                    py::return_value_policy::take_ownership,
+                    "Build a new SceneContext from the snapshot segment `name`, "
+                    "decoding straight from the mapped memory.  `dso_path` sets "
+                    "the new context's DSO path before decoding.")
         // Cameras
         .def("getPrimaryCamera", &rdl2::SceneContext::getPrimaryCamera,
              py::return_value_policy::reference)
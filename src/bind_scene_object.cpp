@@ -1,193 +1,119 @@
 // Copyright (c) 2026 Alan Blevins
 // SPDX-License-Identifier: MIT
 //
-// Python bindings for SceneObject and its UpdateGuard.
+// Python bindings for SceneObject and UpdateBlock.
 
 #include "bindings.h"
+#include "arrays.h"
+#include "attribute_handle.h"
+#include "update_scope.h"
 
 // ---------------------------------------------------------------------------
-// Helper: dynamic attribute getter by name
+// Helpers: NumPy access to numeric vector attributes
 // ---------------------------------------------------------------------------
-static py::object getAttrByName(
+template <typename V>
+static py::array getVectorArray(const rdl2::SceneObject& self, const rdl2::Attribute& attr,
+                                rdl2::AttributeTimestep ts, bool copy, py::handle base)
+{
+    const V& values = self.get(rdl2::AttributeKey<V>(attr), ts);
+    return copy ? arrayCopy(values) : arrayView(values, base);
+}
+
+// A MathArray already holds a V, which set() copies straight into the
+// attribute; anything else is converted once and moved in.
+template <typename V>
+static void setVectorArray(rdl2::SceneObject& self, const rdl2::Attribute& attr,
+                           py::handle array, rdl2::AttributeTimestep ts)
+{
+    const rdl2::AttributeKey<V> key(attr);
+    if (py::isinstance<MathArray<V>>(array)) {
+        self.set(key, array.cast<const MathArray<V>&>().values, ts);
+        return;
+    }
+    V values = vectorFromArray<V>(array);
+    self.set(key, std::move(values), ts);
+}
+
+// `base` is the Python SceneObject that views keep alive.
+static py::array getArrayAttr(
     const rdl2::SceneObject& self,
-    const std::string& name,
-    rdl2::AttributeTimestep ts = rdl2::TIMESTEP_BEGIN)
+    const rdl2::Attribute& attr,
+    rdl2::AttributeTimestep ts,
+    bool copy,
+    py::handle base)
 {
-    const rdl2::Attribute* attr = self.getSceneClass().getAttribute(name);
-    switch (attr->getType()) {
-        case rdl2::TYPE_BOOL:   return py::cast(self.get(rdl2::AttributeKey<rdl2::Bool>(*attr), ts));
-        case rdl2::TYPE_INT:    return py::cast(self.get(rdl2::AttributeKey<rdl2::Int>(*attr), ts));
-        case rdl2::TYPE_LONG:   return py::cast(self.get(rdl2::AttributeKey<rdl2::Long>(*attr), ts));
-        case rdl2::TYPE_FLOAT:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Float>(*attr), ts));
-        case rdl2::TYPE_DOUBLE: return py::cast(self.get(rdl2::AttributeKey<rdl2::Double>(*attr), ts));
-        case rdl2::TYPE_STRING: return py::cast(self.get(rdl2::AttributeKey<rdl2::String>(*attr), ts));
-        case rdl2::TYPE_RGB:    return py::cast(self.get(rdl2::AttributeKey<rdl2::Rgb>(*attr), ts));
-        case rdl2::TYPE_RGBA:   return py::cast(self.get(rdl2::AttributeKey<rdl2::Rgba>(*attr), ts));
-        case rdl2::TYPE_VEC2F:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec2f>(*attr), ts));
-        case rdl2::TYPE_VEC2D:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec2d>(*attr), ts));
-        case rdl2::TYPE_VEC3F:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec3f>(*attr), ts));
-        case rdl2::TYPE_VEC3D:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec3d>(*attr), ts));
-        case rdl2::TYPE_VEC4F:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec4f>(*attr), ts));
-        case rdl2::TYPE_VEC4D:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec4d>(*attr), ts));
-        case rdl2::TYPE_MAT4F:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Mat4f>(*attr), ts));
-        case rdl2::TYPE_MAT4D:  return py::cast(self.get(rdl2::AttributeKey<rdl2::Mat4d>(*attr), ts));
-        case rdl2::TYPE_SCENE_OBJECT:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::SceneObject*>(*attr)));
-        case rdl2::TYPE_BOOL_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::BoolVector>(*attr)));
-        case rdl2::TYPE_INT_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::IntVector>(*attr)));
-        case rdl2::TYPE_LONG_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::LongVector>(*attr)));
-        case rdl2::TYPE_FLOAT_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::FloatVector>(*attr)));
-        case rdl2::TYPE_DOUBLE_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::DoubleVector>(*attr)));
-        case rdl2::TYPE_STRING_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::StringVector>(*attr)));
-        case rdl2::TYPE_RGB_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::RgbVector>(*attr)));
-        case rdl2::TYPE_RGBA_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::RgbaVector>(*attr)));
-        case rdl2::TYPE_VEC2F_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec2fVector>(*attr)));
-        case rdl2::TYPE_VEC2D_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec2dVector>(*attr)));
-        case rdl2::TYPE_VEC3F_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec3fVector>(*attr)));
-        case rdl2::TYPE_VEC3D_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec3dVector>(*attr)));
-        case rdl2::TYPE_VEC4F_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec4fVector>(*attr)));
-        case rdl2::TYPE_VEC4D_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Vec4dVector>(*attr)));
-        case rdl2::TYPE_MAT4F_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Mat4fVector>(*attr)));
-        case rdl2::TYPE_MAT4D_VECTOR:
-            return py::cast(self.get(rdl2::AttributeKey<rdl2::Mat4dVector>(*attr)));
-        case rdl2::TYPE_SCENE_OBJECT_VECTOR: {
-            const rdl2::SceneObjectVector& v =
-                self.get(rdl2::AttributeKey<rdl2::SceneObjectVector>(*attr));
-            return py::cast(v);
-        }
-        case rdl2::TYPE_SCENE_OBJECT_INDEXABLE: {
-            const rdl2::SceneObjectIndexable& v =
-                self.get(rdl2::AttributeKey<rdl2::SceneObjectIndexable>(*attr));
-            std::vector<rdl2::SceneObject*> result(v.begin(), v.end());
-            return py::cast(result);
-        }
+    switch (attr.getType()) {
+        case rdl2::TYPE_INT_VECTOR:    return getVectorArray<rdl2::IntVector>   (self, attr, ts, copy, base);
+        case rdl2::TYPE_LONG_VECTOR:   return getVectorArray<rdl2::LongVector>  (self, attr, ts, copy, base);
+        case rdl2::TYPE_FLOAT_VECTOR:  return getVectorArray<rdl2::FloatVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_DOUBLE_VECTOR: return getVectorArray<rdl2::DoubleVector>(self, attr, ts, copy, base);
+        case rdl2::TYPE_RGB_VECTOR:    return getVectorArray<rdl2::RgbVector>   (self, attr, ts, copy, base);
+        case rdl2::TYPE_RGBA_VECTOR:   return getVectorArray<rdl2::RgbaVector>  (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC2F_VECTOR:  return getVectorArray<rdl2::Vec2fVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC2D_VECTOR:  return getVectorArray<rdl2::Vec2dVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC3F_VECTOR:  return getVectorArray<rdl2::Vec3fVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC3D_VECTOR:  return getVectorArray<rdl2::Vec3dVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC4F_VECTOR:  return getVectorArray<rdl2::Vec4fVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_VEC4D_VECTOR:  return getVectorArray<rdl2::Vec4dVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_MAT4F_VECTOR:  return getVectorArray<rdl2::Mat4fVector> (self, attr, ts, copy, base);
+        case rdl2::TYPE_MAT4D_VECTOR:  return getVectorArray<rdl2::Mat4dVector> (self, attr, ts, copy, base);
+        default:
+            throw py::type_error(std::string("getArray() does not support attributes of type ") +
+                                 rdl2::attributeTypeName(attr.getType()));
+    }
+}
+
+// Caller must hold an UpdateScope on `self`.
+static void setArrayAttr(
+    rdl2::SceneObject& self,
+    const rdl2::Attribute& attr,
+    py::handle array,
+    rdl2::AttributeTimestep ts)
+{
+    switch (attr.getType()) {
+        case rdl2::TYPE_INT_VECTOR:    setVectorArray<rdl2::IntVector>   (self, attr, array, ts); break;
+        case rdl2::TYPE_LONG_VECTOR:   setVectorArray<rdl2::LongVector>  (self, attr, array, ts); break;
+        case rdl2::TYPE_FLOAT_VECTOR:  setVectorArray<rdl2::FloatVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_DOUBLE_VECTOR: setVectorArray<rdl2::DoubleVector>(self, attr, array, ts); break;
+        case rdl2::TYPE_RGB_VECTOR:    setVectorArray<rdl2::RgbVector>   (self, attr, array, ts); break;
+        case rdl2::TYPE_RGBA_VECTOR:   setVectorArray<rdl2::RgbaVector>  (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC2F_VECTOR:  setVectorArray<rdl2::Vec2fVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC2D_VECTOR:  setVectorArray<rdl2::Vec2dVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC3F_VECTOR:  setVectorArray<rdl2::Vec3fVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC3D_VECTOR:  setVectorArray<rdl2::Vec3dVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC4F_VECTOR:  setVectorArray<rdl2::Vec4fVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_VEC4D_VECTOR:  setVectorArray<rdl2::Vec4dVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_MAT4F_VECTOR:  setVectorArray<rdl2::Mat4fVector> (self, attr, array, ts); break;
+        case rdl2::TYPE_MAT4D_VECTOR:  setVectorArray<rdl2::Mat4dVector> (self, attr, array, ts); break;
         default:
-            throw std::runtime_error("Unknown or unsupported attribute type for get()");
+            throw py::type_error(std::string("setArray() does not support attributes of type ") +
+                                 rdl2::attributeTypeName(attr.getType()));
     }
+    recordChange(&self, &attr);
 }
 
 // ---------------------------------------------------------------------------
-// Helper: dynamic attribute setter by name
+// Helpers: dynamic attribute get/set by name, through the cached
+// AttributeHandle for the object's SceneClass (see attribute_handle.h)
 // ---------------------------------------------------------------------------
+static py::object getAttrByName(
+    const rdl2::SceneObject& self,
+    const std::string& name,
+    rdl2::AttributeTimestep ts = rdl2::TIMESTEP_BEGIN)
+{
+    ProfileScope profile(Probe::GetItem);
+    return getAttributeHandle(self.getSceneClass(), name)->get(self, ts);
+}
+
 static void setAttrByName(
     rdl2::SceneObject& self,
     const std::string& name,
     py::object value,
     rdl2::AttributeTimestep ts = rdl2::TIMESTEP_BEGIN)
 {
-    rdl2::SceneObject::UpdateGuard guard(&self);
-    const rdl2::Attribute* attr = self.getSceneClass().getAttribute(name);
-    switch (attr->getType()) {
-        case rdl2::TYPE_BOOL:
-            self.set(rdl2::AttributeKey<rdl2::Bool>(*attr), value.cast<rdl2::Bool>(), ts); break;
-        case rdl2::TYPE_INT:
-            self.set(rdl2::AttributeKey<rdl2::Int>(*attr), value.cast<rdl2::Int>(), ts); break;
-        case rdl2::TYPE_LONG:
-            self.set(rdl2::AttributeKey<rdl2::Long>(*attr), value.cast<rdl2::Long>(), ts); break;
-        case rdl2::TYPE_FLOAT:
-            self.set(rdl2::AttributeKey<rdl2::Float>(*attr), value.cast<rdl2::Float>(), ts); break;
-        case rdl2::TYPE_DOUBLE:
-            self.set(rdl2::AttributeKey<rdl2::Double>(*attr), value.cast<rdl2::Double>(), ts); break;
-        case rdl2::TYPE_STRING:
-            self.set(rdl2::AttributeKey<rdl2::String>(*attr), value.cast<rdl2::String>(), ts); break;
-        case rdl2::TYPE_RGB:
-            self.set(rdl2::AttributeKey<rdl2::Rgb>(*attr), value.cast<rdl2::Rgb>(), ts); break;
-        case rdl2::TYPE_RGBA:
-            self.set(rdl2::AttributeKey<rdl2::Rgba>(*attr), value.cast<rdl2::Rgba>(), ts); break;
-        case rdl2::TYPE_VEC2F:
-            self.set(rdl2::AttributeKey<rdl2::Vec2f>(*attr), value.cast<rdl2::Vec2f>(), ts); break;
-        case rdl2::TYPE_VEC2D:
-            self.set(rdl2::AttributeKey<rdl2::Vec2d>(*attr), value.cast<rdl2::Vec2d>(), ts); break;
-        case rdl2::TYPE_VEC3F:
-            self.set(rdl2::AttributeKey<rdl2::Vec3f>(*attr), value.cast<rdl2::Vec3f>(), ts); break;
-        case rdl2::TYPE_VEC3D:
-            self.set(rdl2::AttributeKey<rdl2::Vec3d>(*attr), value.cast<rdl2::Vec3d>(), ts); break;
-        case rdl2::TYPE_VEC4F:
-            self.set(rdl2::AttributeKey<rdl2::Vec4f>(*attr), value.cast<rdl2::Vec4f>(), ts); break;
-        case rdl2::TYPE_VEC4D:
-            self.set(rdl2::AttributeKey<rdl2::Vec4d>(*attr), value.cast<rdl2::Vec4d>(), ts); break;
-        case rdl2::TYPE_MAT4F:
-            self.set(rdl2::AttributeKey<rdl2::Mat4f>(*attr), value.cast<rdl2::Mat4f>(), ts); break;
-        case rdl2::TYPE_MAT4D:
-            self.set(rdl2::AttributeKey<rdl2::Mat4d>(*attr), value.cast<rdl2::Mat4d>(), ts); break;
-        case rdl2::TYPE_SCENE_OBJECT:
-            self.set(rdl2::AttributeKey<rdl2::SceneObject*>(*attr),
-                     value.cast<rdl2::SceneObject*>()); break;
-        case rdl2::TYPE_BOOL_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::BoolVector>(*attr),
-                     value.cast<rdl2::BoolVector>(), ts); break;
-        case rdl2::TYPE_INT_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::IntVector>(*attr),
-                     value.cast<rdl2::IntVector>(), ts); break;
-        case rdl2::TYPE_LONG_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::LongVector>(*attr),
-                     value.cast<rdl2::LongVector>(), ts); break;
-        case rdl2::TYPE_FLOAT_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::FloatVector>(*attr),
-                     value.cast<rdl2::FloatVector>(), ts); break;
-        case rdl2::TYPE_DOUBLE_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::DoubleVector>(*attr),
-                     value.cast<rdl2::DoubleVector>(), ts); break;
-        case rdl2::TYPE_STRING_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::StringVector>(*attr),
-                     value.cast<rdl2::StringVector>(), ts); break;
-        case rdl2::TYPE_RGB_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::RgbVector>(*attr),
-                     value.cast<rdl2::RgbVector>(), ts); break;
-        case rdl2::TYPE_RGBA_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::RgbaVector>(*attr),
-                     value.cast<rdl2::RgbaVector>(), ts); break;
-        case rdl2::TYPE_VEC2F_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec2fVector>(*attr),
-                     value.cast<rdl2::Vec2fVector>(), ts); break;
-        case rdl2::TYPE_VEC2D_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec2dVector>(*attr),
-                     value.cast<rdl2::Vec2dVector>(), ts); break;
-        case rdl2::TYPE_VEC3F_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec3fVector>(*attr),
-                     value.cast<rdl2::Vec3fVector>(), ts); break;
-        case rdl2::TYPE_VEC3D_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec3dVector>(*attr),
-                     value.cast<rdl2::Vec3dVector>(), ts); break;
-        case rdl2::TYPE_VEC4F_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec4fVector>(*attr),
-                     value.cast<rdl2::Vec4fVector>(), ts); break;
-        case rdl2::TYPE_VEC4D_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Vec4dVector>(*attr),
-                     value.cast<rdl2::Vec4dVector>(), ts); break;
-        case rdl2::TYPE_MAT4F_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Mat4fVector>(*attr),
-                     value.cast<rdl2::Mat4fVector>(), ts); break;
-        case rdl2::TYPE_MAT4D_VECTOR:
-            self.set(rdl2::AttributeKey<rdl2::Mat4dVector>(*attr),
-                     value.cast<rdl2::Mat4dVector>(), ts); break;
-        case rdl2::TYPE_SCENE_OBJECT_VECTOR: {
-            rdl2::SceneObjectVector v = value.cast<rdl2::SceneObjectVector>();
-            self.set(rdl2::AttributeKey<rdl2::SceneObjectVector>(*attr), v, ts); break;
-        }
-        case rdl2::TYPE_SCENE_OBJECT_INDEXABLE: {
-            auto list = value.cast<std::vector<rdl2::SceneObject*>>();
-            rdl2::SceneObjectIndexable indexable(list.begin(), list.end());
-            self.set(rdl2::AttributeKey<rdl2::SceneObjectIndexable>(*attr), indexable, ts); break;
-        }
-        default:
-            throw std::runtime_error("Unknown or unsupported attribute type for set()");
-    }
+    ProfileScope profile(Probe::SetItem);
+    UpdateScope guard(&self);
+    getAttributeHandle(self.getSceneClass(), name)->set(self, value, ts);
 }
 
 // ---------------------------------------------------------------------------
@@ -209,7 +135,7 @@ static rdl2::SceneObject* getBindingByName(const rdl2::SceneObject& self, const
 }
 
 static void setBindingByName(rdl2::SceneObject& self, const std::string& name, rdl2::SceneObject* obj) {
-    rdl2::SceneObject::UpdateGuard guard(&self);
+    UpdateScope guard(&self);
     self.setBinding(name, obj);
 }
 
@@ -228,6 +154,20 @@ static bool isDefaultAndUnboundByName(const rdl2::SceneObject& self, const std::
 // ---------------------------------------------------------------------------
 void bind_scene_object(py::module_& m)
 {
+    // UpdateBlock: returned by SceneObject.update() and
+    // SceneContext.batchUpdate(); see UpdateScope in update_scope.h.
+    py::class_<UpdateBlock>(m, "UpdateBlock")
+        .def("__enter__", [](py::object self) {
+            self.cast<UpdateBlock&>().enter();
+            return self;
+        })
+        .def("__exit__", [](UpdateBlock& self, py::object, py::object, py::object) {
+            self.exit();
+            return false;
+        })
+        .def("getObjects", &UpdateBlock::getObjects, py::return_value_policy::reference)
+        .def("isActive", &UpdateBlock::isActive);
+
     py::class_<rdl2::SceneObject,
                std::unique_ptr<rdl2::SceneObject, py::nodelete>> sceneObjectClass(m, "SceneObject");
     sceneObjectClass
@@ -356,24 +296,66 @@ void bind_scene_object(py::module_& m)
             }
             throw py::key_error("key must be a string or (string, AttributeTimestep) tuple");
         })
+        // NumPy access to numeric vector attributes (Int/Long/Float/Double,
+        // Rgb/Rgba, Vec2-4f/d and Mat4f/d vectors) without per-element boxing.
+        .def("getArray", [](py::object pySelf, const std::string& name,
+                            rdl2::AttributeTimestep ts, bool copy) {
+            const rdl2::SceneObject& self = pySelf.cast<const rdl2::SceneObject&>();
+            const rdl2::Attribute* attr = self.getSceneClass().getAttribute(name);
+            return getArrayAttr(self, *attr, ts, copy, pySelf);
+        }, py::arg("name"), py::arg("timestep") = rdl2::TIMESTEP_BEGIN,
+           py::arg("copy") = true,
+           "Return a vector attribute as an independent ndarray, e.g. (N, 3) "
+           "float32 for Vec3fVector.  copy=False instead returns a read-only "
+           "view of the rdl2 storage without copying.  The view is unsafe: it "
+           "does not keep the storage alive, and reading it after the attribute "
+           "is next set or reset reads freed memory.")
+        .def("setArray", [](rdl2::SceneObject& self, const std::string& name,
+                            py::object array, rdl2::AttributeTimestep ts) {
+            UpdateScope guard(&self);
+            const rdl2::Attribute* attr = self.getSceneClass().getAttribute(name);
+            setArrayAttr(self, *attr, array, ts);
+        }, py::arg("name"), py::arg("array"), py::arg("timestep") = rdl2::TIMESTEP_BEGIN,
+           "Set a vector attribute from an ndarray (or any array-like) of "
+           "matching shape with a single bulk copy.")
         // "attr" in obj -> True if the SceneClass declares that attribute
         .def("__contains__", [](const rdl2::SceneObject& self, const std::string& name) {
             try { self.getSceneClass().getAttribute(name); return true; }
             catch (...) { return false; }
         })
+        // Batched updates: one begin/endUpdate cycle for a whole `with` block
+        .def("update", [](rdl2::SceneObject& self) {
+            return UpdateBlock({&self});
+        }, "Context manager holding this object open for update; setters used "
+           "inside the block skip their own begin/endUpdate.")
         // Reset
         .def("resetToDefault", [](rdl2::SceneObject& self, const std::string& name) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.resetToDefault(name);
+            recordChange(&self, self.getSceneClass().getAttribute(name));
         }, py::arg("name"))
         .def("resetToDefault", [](rdl2::SceneObject& self, const rdl2::Attribute* attr) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.resetToDefault(attr);
+            recordChange(&self, attr);
         }, py::arg("attribute"))
         .def("resetAllToDefault", [](rdl2::SceneObject& self) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.resetAllToDefault();
         })
+        // Content hashing (content_hash.cpp)
+        .def("contentHash", &contentHash,
+             py::arg("include_bindings") = true, py::arg("recursive") = false,
+             "Stable 128-bit MurmurHash3 of the class name and every attribute "
+             "value (both timesteps), as 32 hex digits.  The object's own name is "
+             "not included.  Referenced objects hash by name, or with "
+             "recursive=True by their own recursive hashes.")
+        // Memory accounting (memory_usage.cpp)
+        .def("memoryUsage", &memoryUsage, py::arg("by_attribute") = false,
+             "Estimated bytes held by this object's attribute values: inline "
+             "storage for each timestep plus owned heap memory (vector and "
+             "string capacity).  With by_attribute=True, returns "
+             "{attribute name: bytes}, largest first.")
         // Default checking
         .def("isDefault",          &isDefaultByName,          py::arg("name"))
         .def("isDefaultAndUnbound",&isDefaultAndUnboundByName, py::arg("name"))
@@ -387,16 +369,16 @@ void bind_scene_object(py::module_& m)
              py::return_value_policy::reference)
         .def("setBinding", &setBindingByName, py::arg("name"), py::arg("object"))
         .def("setBinding", [](rdl2::SceneObject& self, const rdl2::Attribute& attr, rdl2::SceneObject* obj) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setBinding(attr, obj);
         }, py::arg("attribute"), py::arg("object"))
         // Copy
         .def("copyAll", [](rdl2::SceneObject& self, const rdl2::SceneObject& source) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.copyAll(source);
         }, py::arg("source"))
         .def("copyValues", [](rdl2::SceneObject& self, const std::string& attrName, const rdl2::SceneObject& source) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             const rdl2::Attribute* attr = self.getSceneClass().getAttribute(attrName);
             self.copyValues(*attr, source);
         }, py::arg("attribute_name"), py::arg("source"))
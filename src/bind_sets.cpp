@@ -5,6 +5,107 @@
 //   GeometrySet, LightSet
 
 #include "bindings.h"
+#include "arrays.h"
+#include "update_scope.h"
+
+#include <unordered_map>
+
+// ---------------------------------------------------------------------------
+// UserData array channels: set<Type>Array / get<Type>Array for the
+// dual-timestep types, moving whole channels to and from ndarrays.
+// ---------------------------------------------------------------------------
+template <typename V>
+struct UserDataChannel
+{
+    void (rdl2::UserData::*set)(const std::string&, const V&);
+    void (rdl2::UserData::*setBlurred)(const std::string&, const V&, const V&);
+    const V& (rdl2::UserData::*values0)() const;
+    const V& (rdl2::UserData::*values1)() const;
+};
+
+template <typename V>
+static void bindUserDataArrays(py::class_<rdl2::UserData, rdl2::SceneObject,
+                                          std::unique_ptr<rdl2::UserData, py::nodelete>>& ud,
+                               const std::string& typeName, UserDataChannel<V> channel)
+{
+    ud.def(("set" + typeName + "Array").c_str(),
+           [channel](rdl2::UserData& self, const std::string& key,
+                     py::object values0, py::object values1) {
+               const V v0 = vectorFromArray<V>(values0);
+               if (values1.is_none()) {
+                   UpdateScope guard(&self);
+                   (self.*channel.set)(key, v0);
+                   return;
+               }
+               const V v1 = vectorFromArray<V>(values1);
+               UpdateScope guard(&self);
+               (self.*channel.setBlurred)(key, v0, v1);
+           }, py::arg("key"), py::arg("values0"), py::arg("values1") = py::none(),
+           ("Set the " + typeName + " channel from an array-like (one bulk copy "
+            "per timestep); pass values1 for a motion-blurred pair.").c_str());
+    ud.def(("get" + typeName + "Array").c_str(),
+           [channel](py::object pySelf, rdl2::AttributeTimestep ts, bool copy) {
+               const rdl2::UserData& self = pySelf.cast<const rdl2::UserData&>();
+               const V& values = ts == rdl2::TIMESTEP_END ? (self.*channel.values1)()
+                                                          : (self.*channel.values0)();
+               return copy ? arrayCopy(values) : arrayView(values, pySelf);
+           }, py::arg("timestep") = rdl2::TIMESTEP_BEGIN, py::arg("copy") = true,
+           ("Return the " + typeName + " channel at `timestep` as an independent "
+            "ndarray.  copy=False instead returns a read-only view without "
+            "copying; it is unsafe, as it reads freed memory once the channel "
+            "is next set.").c_str());
+}
+
+// ---------------------------------------------------------------------------
+// TraceSet bulk helpers: one UpdateScope and one C++ loop per call.  The GIL
+// stays held, as for the single-pair bindings: it is what keeps other Python
+// threads from reading the TraceSet while its vectors are reallocated.
+// ---------------------------------------------------------------------------
+static py::array_t<int32_t> assignMany(rdl2::TraceSet& self, py::object geometries,
+                                       const std::vector<std::string>& parts)
+{
+    // A single Geometry is paired with every part name.
+    std::vector<rdl2::Geometry*> geoms;
+    if (py::isinstance<rdl2::Geometry>(geometries))
+        geoms.assign(parts.size(), geometries.cast<rdl2::Geometry*>());
+    else
+        geoms = geometries.cast<std::vector<rdl2::Geometry*>>();
+    if (geoms.size() != parts.size())
+        throw py::value_error("assignMany() got " + std::to_string(geoms.size()) +
+                              " geometries for " + std::to_string(parts.size()) + " parts");
+    for (const rdl2::Geometry* g : geoms)
+        if (!g) throw py::type_error("assignMany() geometries must not contain None");
+
+    py::array_t<int32_t> ids(static_cast<py::ssize_t>(parts.size()));
+    int32_t* out = ids.mutable_data();
+    {
+        UpdateScope guard(&self);
+        for (size_t i = 0; i < parts.size(); ++i)
+            out[i] = self.assign(geoms[i], parts[i]);
+    }
+    return ids;
+}
+
+static py::tuple lookupMany(const rdl2::TraceSet& self, py::object idsObj)
+{
+    const rdl2::IntVector ids = vectorFromArray<rdl2::IntVector>(idsObj);
+    std::vector<const rdl2::Geometry*> geoms(ids.size());
+    std::vector<std::string> parts(ids.size());
+    py::array_t<int32_t> geomIndex(static_cast<py::ssize_t>(ids.size()));
+    std::vector<const rdl2::Geometry*> unique;
+    std::unordered_map<const rdl2::Geometry*, int32_t> indexOf;
+    int32_t* out = geomIndex.mutable_data();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto pair = self.lookupGeomAndPart(ids[i]);
+        auto inserted = indexOf.emplace(pair.first, static_cast<int32_t>(unique.size()));
+        if (inserted.second)
+            unique.push_back(pair.first);
+        out[i] = inserted.first->second;
+        parts[i] = std::string(pair.second);
+    }
+    return py::make_tuple(py::cast(unique, py::return_value_policy::reference),
+                          geomIndex, py::cast(parts));
+}
 
 void bind_sets(py::module_& m)
 {
@@ -25,16 +126,16 @@ void bind_sets(py::module_& m)
         }, py::return_value_policy::reference,
         "Returns a list of Geometry SceneObjects in this set.")
         .def("add", [](rdl2::GeometrySet& self, rdl2::Geometry* g) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.add(g);
         }, py::arg("geometry"))
         .def("remove", [](rdl2::GeometrySet& self, rdl2::Geometry* g) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.remove(g);
         }, py::arg("geometry"))
         .def("contains", &rdl2::GeometrySet::contains, py::arg("geometry"))
         .def("clear", [](rdl2::GeometrySet& self) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.clear();
         })
         .def("isStatic", &rdl2::GeometrySet::isStatic)
@@ -56,16 +157,16 @@ void bind_sets(py::module_& m)
         }, py::return_value_policy::reference,
         "Returns a list of Light SceneObjects in this set.")
         .def("add", [](rdl2::LightSet& self, rdl2::Light* l) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.add(l);
         }, py::arg("light"))
         .def("remove", [](rdl2::LightSet& self, rdl2::Light* l) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.remove(l);
         }, py::arg("light"))
         .def("contains", &rdl2::LightSet::contains, py::arg("light"))
         .def("clear", [](rdl2::LightSet& self) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.clear();
         });
 
@@ -99,16 +200,16 @@ void bind_sets(py::module_& m)
         }, py::return_value_policy::reference,
         "Returns a list of LightFilter SceneObjects in this set.")
         .def("add", [](rdl2::LightFilterSet& self, rdl2::LightFilter* lf) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.add(lf);
         }, py::arg("light_filter"))
         .def("remove", [](rdl2::LightFilterSet& self, rdl2::LightFilter* lf) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.remove(lf);
         }, py::arg("light_filter"))
         .def("contains", &rdl2::LightFilterSet::contains, py::arg("light_filter"))
         .def("clear", [](rdl2::LightFilterSet& self) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.clear();
         });
 
@@ -166,7 +267,7 @@ void bind_sets(py::module_& m)
                                  const std::vector<std::string>& names,
                                  const std::vector<std::string>& types,
                                  const std::vector<std::string>& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             rdl2::StringVector n(names), t(types), v(values);
             self.setAttributes(n, t, v);
         }, py::arg("names"), py::arg("types"), py::arg("values"),
@@ -198,7 +299,7 @@ void bind_sets(py::module_& m)
         .def("getAssignmentCount", &rdl2::TraceSet::getAssignmentCount,
              "Returns the number of Geometry/Part assignments in this TraceSet.")
         .def("assign", [](rdl2::TraceSet& self, rdl2::Geometry* g, const std::string& part) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             return self.assign(g, part);
         }, py::arg("geometry"), py::arg("part_name"),
         "Add a Geometry/Part pair and return its assignment ID.")
@@ -222,7 +323,14 @@ void bind_sets(py::module_& m)
                 ids.push_back(*it);
             return ids;
         }, py::arg("geometry"),
-        "Return a list of all assignment IDs for the given Geometry.");
+        "Return a list of all assignment IDs for the given Geometry.")
+        .def("assignMany", &assignMany, py::arg("geometries"), py::arg("part_names"),
+             "Add many Geometry/Part pairs (`geometries` may be a single Geometry "
+             "shared by all parts) and return their assignment IDs as an int32 ndarray.")
+        .def("lookupMany", &lookupMany, py::arg("assignment_ids"),
+             "Return (geometries, geometry_indices, part_names) for an array of "
+             "assignment IDs: the distinct Geometries in first-seen order, an "
+             "int32 ndarray indexing into them, and a list of part names.");
 
     // -----------------------------------------------------------------------
     // UserData (inherits SceneObject)
@@ -251,7 +359,7 @@ void bind_sets(py::module_& m)
             return r;
         }), py::arg("scene_object"))
         .def("setRate", [](rdl2::UserData& self, rdl2::UserData::Rate rate) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setRate(static_cast<int>(rate));
         }, py::arg("rate"))
         .def("getRate", [](const rdl2::UserData& self) {
@@ -261,7 +369,7 @@ void bind_sets(py::module_& m)
         .def("hasBoolData",  &rdl2::UserData::hasBoolData)
         .def("setBoolData", [](rdl2::UserData& self, const std::string& key,
                                const rdl2::BoolVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setBoolData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("getBoolKey",    &rdl2::UserData::getBoolKey)
@@ -270,7 +378,7 @@ void bind_sets(py::module_& m)
         .def("hasIntData",  &rdl2::UserData::hasIntData)
         .def("setIntData", [](rdl2::UserData& self, const std::string& key,
                               const rdl2::IntVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setIntData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("getIntKey",    &rdl2::UserData::getIntKey)
@@ -281,13 +389,13 @@ void bind_sets(py::module_& m)
         .def("hasFloatData1", &rdl2::UserData::hasFloatData1)
         .def("setFloatData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::FloatVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setFloatData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("setFloatData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::FloatVector& values0,
                                 const rdl2::FloatVector& values1) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setFloatData(key, values0, values1);
         }, py::arg("key"), py::arg("values0"), py::arg("values1"))
         .def("getFloatKey",    &rdl2::UserData::getFloatKey)
@@ -298,7 +406,7 @@ void bind_sets(py::module_& m)
         .def("hasStringData",  &rdl2::UserData::hasStringData)
         .def("setStringData", [](rdl2::UserData& self, const std::string& key,
                                  const rdl2::StringVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setStringData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("getStringKey",    &rdl2::UserData::getStringKey)
@@ -309,13 +417,13 @@ void bind_sets(py::module_& m)
         .def("hasColorData1", &rdl2::UserData::hasColorData1)
         .def("setColorData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::RgbVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setColorData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("setColorData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::RgbVector& values0,
                                 const rdl2::RgbVector& values1) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setColorData(key, values0, values1);
         }, py::arg("key"), py::arg("values0"), py::arg("values1"))
         .def("getColorKey",    &rdl2::UserData::getColorKey)
@@ -328,13 +436,13 @@ void bind_sets(py::module_& m)
         .def("hasVec2fData1", &rdl2::UserData::hasVec2fData1)
         .def("setVec2fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Vec2fVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setVec2fData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("setVec2fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Vec2fVector& values0,
                                 const rdl2::Vec2fVector& values1) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setVec2fData(key, values0, values1);
         }, py::arg("key"), py::arg("values0"), py::arg("values1"))
         .def("getVec2fKey",    &rdl2::UserData::getVec2fKey)
@@ -347,13 +455,13 @@ void bind_sets(py::module_& m)
         .def("hasVec3fData1", &rdl2::UserData::hasVec3fData1)
         .def("setVec3fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Vec3fVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setVec3fData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("setVec3fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Vec3fVector& values0,
                                 const rdl2::Vec3fVector& values1) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setVec3fData(key, values0, values1);
         }, py::arg("key"), py::arg("values0"), py::arg("values1"))
         .def("getVec3fKey",    &rdl2::UserData::getVec3fKey)
@@ -366,17 +474,34 @@ void bind_sets(py::module_& m)
         .def("hasMat4fData1", &rdl2::UserData::hasMat4fData1)
         .def("setMat4fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Mat4fVector& values) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setMat4fData(key, values);
         }, py::arg("key"), py::arg("values"))
         .def("setMat4fData", [](rdl2::UserData& self, const std::string& key,
                                 const rdl2::Mat4fVector& values0,
                                 const rdl2::Mat4fVector& values1) {
-            rdl2::SceneObject::UpdateGuard guard(&self);
+            UpdateScope guard(&self);
             self.setMat4fData(key, values0, values1);
         }, py::arg("key"), py::arg("values0"), py::arg("values1"))
         .def("getMat4fKey",    &rdl2::UserData::getMat4fKey)
         .def("getMat4fValues", &rdl2::UserData::getMat4fValues)
         .def("getMat4fValues0",&rdl2::UserData::getMat4fValues0)
         .def("getMat4fValues1",&rdl2::UserData::getMat4fValues1);
+
+    // NumPy array variants of the dual-timestep channels
+    bindUserDataArrays<rdl2::FloatVector>(ud, "Float", {
+        &rdl2::UserData::setFloatData, &rdl2::UserData::setFloatData,
+        &rdl2::UserData::getFloatValues0, &rdl2::UserData::getFloatValues1});
+    bindUserDataArrays<rdl2::RgbVector>(ud, "Color", {
+        &rdl2::UserData::setColorData, &rdl2::UserData::setColorData,
+        &rdl2::UserData::getColorValues0, &rdl2::UserData::getColorValues1});
+    bindUserDataArrays<rdl2::Vec2fVector>(ud, "Vec2f", {
+        &rdl2::UserData::setVec2fData, &rdl2::UserData::setVec2fData,
+        &rdl2::UserData::getVec2fValues0, &rdl2::UserData::getVec2fValues1});
+    bindUserDataArrays<rdl2::Vec3fVector>(ud, "Vec3f", {
+        &rdl2::UserData::setVec3fData, &rdl2::UserData::setVec3fData,
+        &rdl2::UserData::getVec3fValues0, &rdl2::UserData::getVec3fValues1});
+    bindUserDataArrays<rdl2::Mat4fVector>(ud, "Mat4f", {
+        &rdl2::UserData::setMat4fData, &rdl2::UserData::setMat4fData,
+        &rdl2::UserData::getMat4fValues0, &rdl2::UserData::getMat4fValues1});
 }
@@ -0,0 +1,215 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// SceneContext snapshots in POSIX shared memory.
+//
+// SceneContext.exportSnapshot() serializes the context with BinaryWriter into
+// a named shared-memory segment holding a single framed-stream frame (see
+// stream_format.h).  Other processes rebuild the context with
+// SceneContext.fromSnapshot(name) (or BinaryReader.fromSnapshot), which maps
+// the segment and decodes it directly, so a scene is parsed once and cloned
+// into any number of workers without going through files or Python bytes.
+//
+// The segment outlives the exporting process until it is unlinked, either
+// explicitly with SceneSnapshot.unlink() or by leaving a `with` block.
+
+#include "bindings.h"
+#include "context_io.h"
+#include "stream_format.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+// shm_open() wants a single leading '/'; accept names with or without it, as
+// Python's multiprocessing.shared_memory does.
+static std::string segmentName(const std::string& name)
+{
+    if (name.empty())
+        throw py::value_error("snapshot name must not be empty");
+    return name[0] == '/' ? name : "/" + name;
+}
+
+// Short enough for macOS' 31-character limit on segment names.
+static std::string uniqueSegmentName()
+{
+    static std::atomic<unsigned> sCounter{0};
+    return "/rdl2-" + std::to_string(::getpid()) + "-" + std::to_string(sCounter++);
+}
+
+// Owns an fd and an optional mapping; closes both on scope exit.
+class SharedMemoryMapping
+{
+public:
+    SharedMemoryMapping() = default;
+    ~SharedMemoryMapping()
+    {
+        if (mData)
+            ::munmap(mData, mSize);
+        if (mFd >= 0)
+            ::close(mFd);
+    }
+
+    SharedMemoryMapping(const SharedMemoryMapping&) = delete;
+    SharedMemoryMapping& operator=(const SharedMemoryMapping&) = delete;
+
+    void open(const std::string& name, int flags)
+    {
+        mFd = ::shm_open(name.c_str(), flags, 0600);
+        if (mFd < 0)
+            throw std::system_error(errno, std::generic_category(),
+                                    "shm_open('" + name + "') failed");
+    }
+
+    void map(size_t size, int prot)
+    {
+        void* data = ::mmap(nullptr, size, prot, MAP_SHARED, mFd, 0);
+        if (data == MAP_FAILED)
+            throw std::system_error(errno, std::generic_category(), "mmap() failed");
+        mData = static_cast<char*>(data);
+        mSize = size;
+    }
+
+    int fd() const { return mFd; }
+    char* data() const { return mData; }
+
+private:
+    int mFd = -1;
+    char* mData = nullptr;
+    size_t mSize = 0;
+};
+
+class SceneSnapshot
+{
+public:
+    SceneSnapshot(std::string name, uint64_t size) : mName(std::move(name)), mSize(size) {}
+
+    const std::string& getName() const { return mName; }
+    uint64_t getSize() const { return mSize; }
+    bool isLinked() const { return mLinked; }
+
+    // Removes the segment name; processes that already attached keep their
+    // mapping.  Safe to call more than once.
+    void unlink()
+    {
+        if (!mLinked)
+            return;
+        mLinked = false;
+        if (::shm_unlink(mName.c_str()) != 0 && errno != ENOENT)
+            throw std::system_error(errno, std::generic_category(),
+                                    "shm_unlink('" + mName + "') failed");
+    }
+
+private:
+    std::string mName;
+    uint64_t mSize;
+    bool mLinked = true;
+};
+
+py::object exportSnapshot(const rdl2::SceneContext& ctx, py::object name)
+{
+    const std::string shmName = name.is_none() ? uniqueSegmentName()
+                                               : segmentName(name.cast<std::string>());
+    uint64_t size = 0;
+    {
+        py::gil_scoped_release release;
+        std::string manifest, payload;
+        rdl2::BinaryWriter(ctx).toBytes(manifest, payload);
+
+        FrameHeader header;
+        header.manifestSize = manifest.size();
+        header.payloadSize = payload.size();
+        size = header.frameSize();
+
+        SharedMemoryMapping segment;
+        segment.open(shmName, O_CREAT | O_EXCL | O_RDWR);
+        try {
+            if (::ftruncate(segment.fd(), static_cast<off_t>(size)) != 0)
+                throw std::system_error(errno, std::generic_category(), "ftruncate() failed");
+            segment.map(size, PROT_READ | PROT_WRITE);
+            char* out = segment.data();
+            encodeFrameHeader(header, out);
+            std::memcpy(out + kFrameHeaderSize, manifest.data(), manifest.size());
+            std::memcpy(out + kFrameHeaderSize + manifest.size(), payload.data(), payload.size());
+        } catch (...) {
+            ::shm_unlink(shmName.c_str());
+            throw;
+        }
+    }
+    return py::cast(SceneSnapshot(shmName, size));
+}
+
+void readSnapshot(BoundBinaryReader& reader, const std::string& name)
+{
+    const std::string shmName = segmentName(name);
+    InvalidateSceneIndexOnExit invalidate(reader.getContext());
+    {
+        py::gil_scoped_release release;
+        std::string manifest, payload;
+        {
+            SharedMemoryMapping segment;
+            segment.open(shmName, O_RDONLY);
+            struct stat st;
+            if (::fstat(segment.fd(), &st) != 0)
+                throw std::system_error(errno, std::generic_category(), "fstat() failed");
+            // Some systems round the segment up to a page, so only require
+            // that the frame fits.
+            const uint64_t available = static_cast<uint64_t>(st.st_size);
+            if (available < kFrameHeaderSize)
+                throw std::runtime_error("snapshot '" + shmName + "' is truncated");
+            segment.map(static_cast<size_t>(available), PROT_READ);
+            const char* in = segment.data();
+            const FrameHeader header = decodeFrameHeader(in);
+            if (!header.compressed() && header.frameSize() > available)
+                throw std::runtime_error("snapshot '" + shmName + "' is truncated");
+            // rdl2::BinaryReader only accepts std::strings, so this is the one
+            // copy out of the mapping.
+            decodeFrameBody(header, in + kFrameHeaderSize, available - kFrameHeaderSize,
+                            manifest, payload);
+        }
+        reader.fromBytes(manifest, payload);
+    }
+}
+
+rdl2::SceneContext* contextFromSnapshot(const std::string& name, py::object dsoPath)
+{
+    // Never deleted, even on failure: ~SceneContext() aborts outside the full
+    // MoonRay pipeline (see the py::nodelete holder in bind_scene_context.cpp).
+    auto* ctx = new rdl2::SceneContext();
+    if (!dsoPath.is_none())
+        ctx->setDsoPath(dsoPath.cast<std::string>());
+    BoundBinaryReader reader(*ctx);
+    readSnapshot(reader, name);
+    return ctx;
+}
+
+// ---------------------------------------------------------------------------
+// bind_snapshot
+// ---------------------------------------------------------------------------
+void bind_snapshot(py::module_& m)
+{
+    py::class_<SceneSnapshot>(m, "SceneSnapshot",
+        "A SceneContext serialized into a named POSIX shared-memory segment "
+        "(see SceneContext.exportSnapshot).  Pass getName() to worker processes.")
+        .def("getName", &SceneSnapshot::getName)
+        .def("getSize", &SceneSnapshot::getSize,
+             "Size of the serialized scene in bytes.")
+        .def("isLinked", &SceneSnapshot::isLinked)
+        .def("unlink", &SceneSnapshot::unlink,
+             "Remove the segment.  Contexts already built from it are unaffected.")
+        .def("__enter__", [](SceneSnapshot& self) -> SceneSnapshot& { return self; },
+             py::return_value_policy::reference_internal)
+        .def("__exit__", [](SceneSnapshot& self, py::object, py::object, py::object) {
+            self.unlink();
+        })
+        .def("__repr__", [](const SceneSnapshot& self) {
+            return "<SceneSnapshot '" + self.getName() + "' " +
+                   std::to_string(self.getSize()) + " bytes>";
+        });
+}
@@ -0,0 +1,443 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// scene_rdl2.validate(): built-in scene checks run in C++ across objects
+// with TBB, returning a list of ValidationIssue records.
+//
+// Rules are resolved against each SceneClass once, serially, into the list of
+// attributes each rule inspects for that class.  The per-object checks then
+// run in parallel with the GIL released; each object writes only its own
+// issue list, and the lists are concatenated in object order so the report
+// is deterministic.  The scene must not be modified while validate() runs.
+
+#include "bindings.h"
+#include "arrays.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <unordered_map>
+
+enum class RuleKind
+{
+    NullReference,      // SceneObject attributes (or vector entries) that are null
+    NonFinite,          // NaN/Inf in floating-point attributes
+    UnboundRequired,    // listed bindable attributes with no binding
+    DanglingMembership, // set members that are null, foreign or of the wrong type
+    EmptySet,           // sets with no members
+};
+
+static const std::pair<const char*, RuleKind> kRuleNames[] = {
+    {"null_reference",      RuleKind::NullReference},
+    {"non_finite",          RuleKind::NonFinite},
+    {"unbound_required",    RuleKind::UnboundRequired},
+    {"dangling_membership", RuleKind::DanglingMembership},
+    {"empty_set",           RuleKind::EmptySet},
+};
+
+static const char* ruleName(RuleKind kind)
+{
+    for (const auto& entry : kRuleNames)
+        if (entry.second == kind)
+            return entry.first;
+    return "";
+}
+
+static const uint32_t kSetInterfaces =
+    rdl2::INTERFACE_GEOMETRYSET | rdl2::INTERFACE_LIGHTSET | rdl2::INTERFACE_SHADOWSET |
+    rdl2::INTERFACE_LIGHTFILTERSET | rdl2::INTERFACE_SHADOWRECEIVERSET;
+
+struct Rule
+{
+    RuleKind kind;
+    uint32_t interfaceMask = 0;           // 0 = any object
+    std::string className;                // empty = any class
+    std::vector<std::string> attributes;  // empty = every applicable attribute
+};
+
+struct ValidationIssue
+{
+    std::string rule;
+    rdl2::SceneObject* object;
+    std::string attribute;
+    std::string message;
+};
+
+// ---------------------------------------------------------------------------
+// Rule parsing.  A rule is a kind name, or a dict with "kind" and optional
+// "interface", "class_name" and "attributes" filters.
+// ---------------------------------------------------------------------------
+static RuleKind parseKind(const std::string& name)
+{
+    for (const auto& entry : kRuleNames)
+        if (name == entry.first)
+            return entry.second;
+    throw py::value_error("unknown validation rule '" + name + "'");
+}
+
+static Rule parseRule(py::handle spec)
+{
+    Rule rule;
+    if (py::isinstance<py::str>(spec)) {
+        rule.kind = parseKind(spec.cast<std::string>());
+    } else {
+        py::dict d = spec.cast<py::dict>();
+        if (!d.contains("kind"))
+            throw py::value_error("validation rule dict needs a 'kind'");
+        rule.kind = parseKind(d["kind"].cast<std::string>());
+        if (d.contains("interface"))
+            rule.interfaceMask = static_cast<uint32_t>(d["interface"].cast<rdl2::SceneObjectInterface>());
+        if (d.contains("class_name"))
+            rule.className = d["class_name"].cast<std::string>();
+        if (d.contains("attributes"))
+            rule.attributes = d["attributes"].cast<std::vector<std::string>>();
+    }
+    if (rule.kind == RuleKind::UnboundRequired && rule.attributes.empty())
+        throw py::value_error("'unbound_required' rule needs an 'attributes' list");
+    if ((rule.kind == RuleKind::DanglingMembership || rule.kind == RuleKind::EmptySet) &&
+        !rule.interfaceMask)
+        rule.interfaceMask = kSetInterfaces;
+    return rule;
+}
+
+static std::vector<Rule> parseRules(py::object rules)
+{
+    std::vector<Rule> result;
+    if (rules.is_none()) {
+        // Every kind that needs no configuration.
+        for (const auto& entry : kRuleNames)
+            if (entry.second != RuleKind::UnboundRequired)
+                result.push_back(parseRule(py::str(entry.first)));
+        return result;
+    }
+    for (py::handle spec : rules)
+        result.push_back(parseRule(spec));
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Per-class plans: for each rule, the attributes it inspects on that class.
+// ---------------------------------------------------------------------------
+static bool isObjectRef(rdl2::AttributeType type)
+{
+    return type == rdl2::TYPE_SCENE_OBJECT || type == rdl2::TYPE_SCENE_OBJECT_VECTOR ||
+           type == rdl2::TYPE_SCENE_OBJECT_INDEXABLE;
+}
+
+static bool isObjectList(rdl2::AttributeType type)
+{
+    return type == rdl2::TYPE_SCENE_OBJECT_VECTOR || type == rdl2::TYPE_SCENE_OBJECT_INDEXABLE;
+}
+
+static bool isFloatingPoint(rdl2::AttributeType type)
+{
+    switch (type) {
+        case rdl2::TYPE_FLOAT:  case rdl2::TYPE_DOUBLE:
+        case rdl2::TYPE_RGB:    case rdl2::TYPE_RGBA:
+        case rdl2::TYPE_VEC2F:  case rdl2::TYPE_VEC2D:
+        case rdl2::TYPE_VEC3F:  case rdl2::TYPE_VEC3D:
+        case rdl2::TYPE_VEC4F:  case rdl2::TYPE_VEC4D:
+        case rdl2::TYPE_MAT4F:  case rdl2::TYPE_MAT4D:
+        case rdl2::TYPE_FLOAT_VECTOR: case rdl2::TYPE_DOUBLE_VECTOR:
+        case rdl2::TYPE_RGB_VECTOR:   case rdl2::TYPE_RGBA_VECTOR:
+        case rdl2::TYPE_VEC2F_VECTOR: case rdl2::TYPE_VEC2D_VECTOR:
+        case rdl2::TYPE_VEC3F_VECTOR: case rdl2::TYPE_VEC3D_VECTOR:
+        case rdl2::TYPE_VEC4F_VECTOR: case rdl2::TYPE_VEC4D_VECTOR:
+        case rdl2::TYPE_MAT4F_VECTOR: case rdl2::TYPE_MAT4D_VECTOR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+using ClassPlan = std::vector<std::vector<const rdl2::Attribute*>>;  // indexed like rules
+
+static ClassPlan planClass(const rdl2::SceneClass& sc, const std::vector<Rule>& rules)
+{
+    ClassPlan plan(rules.size());
+    for (size_t r = 0; r < rules.size(); ++r) {
+        const Rule& rule = rules[r];
+        if (!rule.className.empty() && rule.className != sc.getName())
+            continue;
+        for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it) {
+            const rdl2::Attribute* attr = *it;
+            if (!rule.attributes.empty() &&
+                std::find(rule.attributes.begin(), rule.attributes.end(),
+                          attr->getName()) == rule.attributes.end())
+                continue;
+            if (rule.kind == RuleKind::UnboundRequired) {
+                if (!attr->isBindable())
+                    throw py::value_error("'unbound_required' attribute '" + sc.getName() +
+                                          "." + attr->getName() + "' is not bindable");
+                plan[r].push_back(attr);
+                continue;
+            }
+            const rdl2::AttributeType type = attr->getType();
+            const bool applies = rule.kind == RuleKind::NonFinite ? isFloatingPoint(type)
+                               : rule.kind == RuleKind::NullReference ? isObjectRef(type)
+                               : isObjectList(type);
+            if (applies)
+                plan[r].push_back(attr);
+        }
+    }
+    return plan;
+}
+
+// ---------------------------------------------------------------------------
+// Checks.  Each appends to the issue list of a single object.
+// ---------------------------------------------------------------------------
+using Issues = std::vector<ValidationIssue>;
+
+static void addIssue(Issues& out, RuleKind kind, const rdl2::SceneObject& obj,
+                     const rdl2::Attribute* attr, std::string message)
+{
+    out.push_back({ruleName(kind), const_cast<rdl2::SceneObject*>(&obj),
+                   attr ? attr->getName() : std::string(), std::move(message)});
+}
+
+// Index of the first element of values[0, count) with a NaN or Inf
+// component, or count if all are finite.
+template <typename T>
+static size_t firstNonFinite(const T* values, size_t count)
+{
+    using Scalar = typename ArrayTraits<T>::Scalar;
+    constexpr size_t components = sizeof(T) / sizeof(Scalar);
+    const Scalar* scalars = reinterpret_cast<const Scalar*>(values);
+    for (size_t i = 0; i < count * components; ++i)
+        if (!std::isfinite(scalars[i]))
+            return i / components;
+    return count;
+}
+
+template <typename T>
+static void checkFiniteValue(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, Issues& out)
+{
+    const rdl2::AttributeKey<T> key(*attr);
+    const int steps = attr->isBlurrable() ? 2 : 1;
+    for (int s = 0; s < steps; ++s) {
+        const auto ts = s ? rdl2::TIMESTEP_END : rdl2::TIMESTEP_BEGIN;
+        if (firstNonFinite(&obj.get(key, ts), 1) == 0) {
+            addIssue(out, RuleKind::NonFinite, obj, attr,
+                     std::string("non-finite value at ") + (s ? "TIMESTEP_END" : "TIMESTEP_BEGIN"));
+            return;
+        }
+    }
+}
+
+template <typename V>
+static void checkFiniteVector(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, Issues& out)
+{
+    const V& values = obj.get(rdl2::AttributeKey<V>(*attr));
+    const size_t bad = firstNonFinite(values.data(), values.size());
+    if (bad != values.size())
+        addIssue(out, RuleKind::NonFinite, obj, attr,
+                 "non-finite value at index " + std::to_string(bad));
+}
+
+static void checkFinite(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, Issues& out)
+{
+    switch (attr->getType()) {
+        case rdl2::TYPE_FLOAT:  checkFiniteValue<rdl2::Float>(obj, attr, out); break;
+        case rdl2::TYPE_DOUBLE: checkFiniteValue<rdl2::Double>(obj, attr, out); break;
+        case rdl2::TYPE_RGB:    checkFiniteValue<rdl2::Rgb>(obj, attr, out); break;
+        case rdl2::TYPE_RGBA:   checkFiniteValue<rdl2::Rgba>(obj, attr, out); break;
+        case rdl2::TYPE_VEC2F:  checkFiniteValue<rdl2::Vec2f>(obj, attr, out); break;
+        case rdl2::TYPE_VEC2D:  checkFiniteValue<rdl2::Vec2d>(obj, attr, out); break;
+        case rdl2::TYPE_VEC3F:  checkFiniteValue<rdl2::Vec3f>(obj, attr, out); break;
+        case rdl2::TYPE_VEC3D:  checkFiniteValue<rdl2::Vec3d>(obj, attr, out); break;
+        case rdl2::TYPE_VEC4F:  checkFiniteValue<rdl2::Vec4f>(obj, attr, out); break;
+        case rdl2::TYPE_VEC4D:  checkFiniteValue<rdl2::Vec4d>(obj, attr, out); break;
+        case rdl2::TYPE_MAT4F:  checkFiniteValue<rdl2::Mat4f>(obj, attr, out); break;
+        case rdl2::TYPE_MAT4D:  checkFiniteValue<rdl2::Mat4d>(obj, attr, out); break;
+        case rdl2::TYPE_FLOAT_VECTOR:  checkFiniteVector<rdl2::FloatVector>(obj, attr, out); break;
+        case rdl2::TYPE_DOUBLE_VECTOR: checkFiniteVector<rdl2::DoubleVector>(obj, attr, out); break;
+        case rdl2::TYPE_RGB_VECTOR:    checkFiniteVector<rdl2::RgbVector>(obj, attr, out); break;
+        case rdl2::TYPE_RGBA_VECTOR:   checkFiniteVector<rdl2::RgbaVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC2F_VECTOR:  checkFiniteVector<rdl2::Vec2fVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC2D_VECTOR:  checkFiniteVector<rdl2::Vec2dVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC3F_VECTOR:  checkFiniteVector<rdl2::Vec3fVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC3D_VECTOR:  checkFiniteVector<rdl2::Vec3dVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC4F_VECTOR:  checkFiniteVector<rdl2::Vec4fVector>(obj, attr, out); break;
+        case rdl2::TYPE_VEC4D_VECTOR:  checkFiniteVector<rdl2::Vec4dVector>(obj, attr, out); break;
+        case rdl2::TYPE_MAT4F_VECTOR:  checkFiniteVector<rdl2::Mat4fVector>(obj, attr, out); break;
+        case rdl2::TYPE_MAT4D_VECTOR:  checkFiniteVector<rdl2::Mat4dVector>(obj, attr, out); break;
+        default: break;
+    }
+}
+
+// Calls f(member, index) for each entry of a SceneObject-valued attribute.
+template <typename F>
+static void forEachReference(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, F f)
+{
+    switch (attr->getType()) {
+        case rdl2::TYPE_SCENE_OBJECT:
+            f(obj.get(rdl2::AttributeKey<rdl2::SceneObject*>(*attr)), size_t(0));
+            break;
+        case rdl2::TYPE_SCENE_OBJECT_VECTOR: {
+            const auto& v = obj.get(rdl2::AttributeKey<rdl2::SceneObjectVector>(*attr));
+            for (size_t i = 0; i < v.size(); ++i)
+                f(v[i], i);
+            break;
+        }
+        case rdl2::TYPE_SCENE_OBJECT_INDEXABLE: {
+            const auto& v = obj.get(rdl2::AttributeKey<rdl2::SceneObjectIndexable>(*attr));
+            size_t i = 0;
+            for (rdl2::SceneObject* member : v)
+                f(member, i++);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void checkNull(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, Issues& out)
+{
+    const bool single = attr->getType() == rdl2::TYPE_SCENE_OBJECT;
+    forEachReference(obj, attr, [&](const rdl2::SceneObject* ref, size_t i) {
+        if (!ref)
+            addIssue(out, RuleKind::NullReference, obj, attr,
+                     single ? std::string("null reference")
+                            : "null entry at index " + std::to_string(i));
+    });
+}
+
+static void checkMembers(const rdl2::SceneObject& obj, const rdl2::Attribute* attr, Issues& out)
+{
+    const rdl2::SceneContext* ctx = obj.getSceneClass().getSceneContext();
+    const auto expected = attr->getObjectType();
+    forEachReference(obj, attr, [&](const rdl2::SceneObject* member, size_t i) {
+        const std::string where = " at index " + std::to_string(i);
+        if (!member)
+            addIssue(out, RuleKind::DanglingMembership, obj, attr, "null member" + where);
+        else if (member->getSceneClass().getSceneContext() != ctx)
+            addIssue(out, RuleKind::DanglingMembership, obj, attr,
+                     "member '" + member->getName() + "' belongs to another SceneContext" + where);
+        else if (expected != rdl2::INTERFACE_GENERIC && !(member->getType() & expected))
+            addIssue(out, RuleKind::DanglingMembership, obj, attr,
+                     "member '" + member->getName() + "' of class '" +
+                     member->getSceneClass().getName() + "' has the wrong type" + where);
+    });
+}
+
+static void checkEmpty(const rdl2::SceneObject& obj,
+                       const std::vector<const rdl2::Attribute*>& attrs, Issues& out)
+{
+    if (attrs.empty())
+        return;
+    for (const rdl2::Attribute* attr : attrs) {
+        bool any = false;
+        forEachReference(obj, attr, [&](const rdl2::SceneObject*, size_t) { any = true; });
+        if (any)
+            return;
+    }
+    addIssue(out, RuleKind::EmptySet, obj, nullptr, "set has no members");
+}
+
+static void validateObject(const rdl2::SceneObject& obj, const std::vector<Rule>& rules,
+                           const ClassPlan& plan, Issues& out)
+{
+    for (size_t r = 0; r < rules.size(); ++r) {
+        const Rule& rule = rules[r];
+        if (rule.interfaceMask && !(obj.getType() & rule.interfaceMask))
+            continue;
+        const auto& attrs = plan[r];
+        switch (rule.kind) {
+            case RuleKind::NullReference:
+                for (const rdl2::Attribute* attr : attrs) checkNull(obj, attr, out);
+                break;
+            case RuleKind::NonFinite:
+                for (const rdl2::Attribute* attr : attrs) checkFinite(obj, attr, out);
+                break;
+            case RuleKind::UnboundRequired:
+                for (const rdl2::Attribute* attr : attrs)
+                    if (!obj.getBinding(*attr))
+                        addIssue(out, rule.kind, obj, attr, "required binding is missing");
+                break;
+            case RuleKind::DanglingMembership:
+                for (const rdl2::Attribute* attr : attrs) checkMembers(obj, attr, out);
+                break;
+            case RuleKind::EmptySet:
+                checkEmpty(obj, attrs, out);
+                break;
+        }
+    }
+}
+
+static std::vector<ValidationIssue> validate(rdl2::SceneContext& ctx, py::object rulesObj,
+                                             py::object objectsObj)
+{
+    const std::vector<Rule> rules = parseRules(rulesObj);
+
+    std::vector<const rdl2::SceneObject*> objects;
+    if (objectsObj.is_none()) {
+        for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+            objects.push_back(it->second);
+    } else {
+        for (const rdl2::SceneObject* obj : objectsObj.cast<std::vector<rdl2::SceneObject*>>()) {
+            if (!obj)
+                throw py::type_error("validate() objects must not contain None");
+            objects.push_back(obj);
+        }
+    }
+
+    // Class plans are built up front so the parallel phase only reads them.
+    std::unordered_map<const rdl2::SceneClass*, ClassPlan> plans;
+    std::vector<const ClassPlan*> objectPlans(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i) {
+        const rdl2::SceneClass* sc = &objects[i]->getSceneClass();
+        auto it = plans.find(sc);
+        if (it == plans.end())
+            it = plans.emplace(sc, planClass(*sc, rules)).first;
+        objectPlans[i] = &it->second;
+    }
+
+    std::vector<Issues> perObject(objects.size());
+    {
+        py::gil_scoped_release release;
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, objects.size(), 64),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    validateObject(*objects[i], rules, *objectPlans[i], perObject[i]);
+            });
+    }
+
+    std::vector<ValidationIssue> issues;
+    for (Issues& list : perObject)
+        std::move(list.begin(), list.end(), std::back_inserter(issues));
+    return issues;
+}
+
+// ---------------------------------------------------------------------------
+// bind_validate
+// ---------------------------------------------------------------------------
+void bind_validate(py::module_& m)
+{
+    py::class_<ValidationIssue>(m, "ValidationIssue",
+        "One problem reported by validate().")
+        .def_readonly("rule", &ValidationIssue::rule)
+        .def_property_readonly("object", [](const ValidationIssue& self) { return self.object; },
+                               py::return_value_policy::reference)
+        .def_readonly("attribute", &ValidationIssue::attribute,
+                      "Attribute name, or '' for object-level issues.")
+        .def_readonly("message", &ValidationIssue::message)
+        .def("__repr__", [](const ValidationIssue& self) {
+            std::string where = self.object->getName();
+            if (!self.attribute.empty())
+                where += "." + self.attribute;
+            return "<ValidationIssue " + self.rule + " " + where + ": " + self.message + ">";
+        });
+
+    m.def("validate", &validate,
+          py::arg("context"), py::arg("rules") = py::none(), py::arg("objects") = py::none(),
+          "Check `objects` (default: every object in `context`) against `rules` "
+          "in parallel and return a list of ValidationIssue, in object order.  "
+          "Each rule is a kind name ('null_reference', 'non_finite', "
+          "'unbound_required', 'dangling_membership', 'empty_set') or a dict with "
+          "'kind' and optional 'interface', 'class_name' and 'attributes' filters.  "
+          "The default runs every kind except 'unbound_required', which needs "
+          "'attributes'.");
+}
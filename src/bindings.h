@@ -11,6 +11,8 @@
 #include <pybind11/operators.h>
 #include <pybind11/functional.h>
 
+#include <vector>
+
 // scene_rdl2 headers — order matters for forward declarations
 #include <scene_rdl2/scene/rdl2/Types.h>
 #include <scene_rdl2/scene/rdl2/Attribute.h>
@@ -94,6 +96,31 @@ MARK_NON_COPYABLE(scene_rdl2::rdl2::UserData)
 namespace py  = pybind11;
 namespace rdl2 = scene_rdl2::rdl2;
 
+// Object-indexed archives — implemented in bind_archive.cpp.  readIndex
+// returns a list of ArchiveEntry; readObjects returns the number of objects
+// decoded.  writeIndexedFile stores numeric vectors of at least dedupMinBytes
+// (0: none) once each, as shared blobs.  writeIndexedFile and readObjects do
+// not need the GIL.
+void writeIndexedFile(const rdl2::SceneContext& ctx, const std::string& filename,
+                      uint64_t dedupMinBytes);
+py::list readIndex(const std::string& filename);
+size_t readObjects(rdl2::SceneContext& ctx, const std::string& filename,
+                   const std::vector<std::string>& names, bool withReferences);
+
+// Content hashes — implemented in content_hash.cpp.  contentHash returns 32
+// hex digits; hashAll returns {object name: hex digest}.  Both release the GIL.
+std::string contentHash(const rdl2::SceneObject& obj, bool includeBindings, bool recursive);
+py::dict hashAll(const rdl2::SceneContext& ctx, bool includeBindings, bool recursive);
+
+// Memory accounting — implemented in memory_usage.cpp.  memoryUsage returns
+// total bytes, or {attribute name: bytes} when byAttribute is set.
+py::object memoryUsage(const rdl2::SceneObject& obj, bool byAttribute);
+py::dict memoryReport(const rdl2::SceneContext& ctx, const std::string& groupBy);
+
+// Reference graph — implemented in bind_dependency_graph.cpp.  Returns a
+// DependencyGraph; builds it without the GIL.
+py::object dependencyGraph(const rdl2::SceneContext& ctx);
+
 // ---------------------------------------------------------------------------
 // Per-class binding functions — implemented in bind_*.cpp, called from
 // PYBIND11_MODULE in module.cpp.  Must be called in the order listed so that
@@ -103,6 +130,7 @@ void bind_math(py::module_& m);
 void bind_types(py::module_& m);
 void bind_attribute(py::module_& m);
 void bind_scene_object(py::module_& m);
+void bind_attribute_handle(py::module_& m);
 void bind_scene_variables(py::module_& m);
 void bind_node(py::module_& m);
 void bind_light(py::module_& m);
@@ -110,5 +138,12 @@ void bind_shaders(py::module_& m);
 void bind_sets(py::module_& m);
 void bind_layer(py::module_& m);
 void bind_render_output(py::module_& m);
+void bind_snapshot(py::module_& m);
+void bind_archive(py::module_& m);
+void bind_dependency_graph(py::module_& m);
 void bind_scene_context(py::module_& m);
 void bind_io(py::module_& m);
+void bind_change_tracker(py::module_& m);
+void bind_validate(py::module_& m);
+void bind_diff(py::module_& m);
+void bind_profiling(py::module_& m);
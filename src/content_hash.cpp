@@ -0,0 +1,345 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// SceneObject.contentHash() and SceneContext.hashAll(): stable 128-bit
+// MurmurHash3 digests of attribute values, computed in C++ (see murmur3.h).
+//
+// An object's hash covers its SceneClass name and, for each attribute in
+// declaration order, the attribute's name, type and value.  For blurrable
+// attributes both timesteps are included, and with include_bindings the name
+// of the bound object is too.  The object's own name is left out, so
+// identically configured objects hash equal.  Values are hashed bitwise:
+// 0.0 and -0.0 differ.
+//
+// References to other SceneObjects hash by name.  With recursive=True the
+// hash is instead Merkle-style: it also folds in the recursive hashes of every
+// referenced object, so it changes whenever anything reachable from the
+// object changes.  Objects in a reference cycle share one digest for the
+// whole cycle, combined with their own.
+//
+// Objects are hashed in parallel with TBB.  The context must not be modified
+// while hashing runs.
+
+#include "bindings.h"
+#include "arrays.h"
+#include "murmur3.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+
+// ---------------------------------------------------------------------------
+// ObjectHasher: the non-recursive hash of one object
+// ---------------------------------------------------------------------------
+
+class ObjectHasher
+{
+public:
+    // Referenced objects are appended to `refs`, if given, in the order hashed.
+    ObjectHasher(bool includeBindings, std::vector<const rdl2::SceneObject*>* refs)
+        : mIncludeBindings(includeBindings), mRefs(refs) {}
+
+    Hash128 hash(const rdl2::SceneObject& obj)
+    {
+        const rdl2::SceneClass& sc = obj.getSceneClass();
+        mHasher.addString(sc.getName());
+        for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it) {
+            const rdl2::Attribute& attr = **it;
+            mHasher.addString(attr.getName());
+            mHasher.add(static_cast<int32_t>(attr.getType()));
+            addAttribute(obj, attr);
+            if (mIncludeBindings && attr.isBindable())
+                addRef(obj.getBinding(attr));
+        }
+        return mHasher.digest();
+    }
+
+private:
+    void addRef(const rdl2::SceneObject* obj)
+    {
+        mHasher.add(static_cast<uint8_t>(obj != nullptr));
+        if (!obj)
+            return;
+        mHasher.addString(obj->getName());
+        if (mRefs)
+            mRefs->push_back(obj);
+    }
+
+    // Math types and numbers: tightly packed (checked in arrays.h).
+    template <typename T>
+    void addValue(const T& value)
+    {
+        static_assert(IsArrayElement<T>::value, "no hash encoding for this type");
+        mHasher.add(value);
+    }
+    void addValue(bool value) { mHasher.add(static_cast<uint8_t>(value)); }
+    void addValue(const std::string& value) { mHasher.addString(value); }
+    void addValue(rdl2::SceneObject* value) { addRef(value); }
+
+    template <typename V>
+    void addElements(const V& values, std::true_type /*packed*/)
+    {
+        mHasher.update(values.data(), values.size() * sizeof(typename V::value_type));
+    }
+
+    template <typename V>
+    void addElements(const V& values, std::false_type)
+    {
+        for (const auto& value : values)
+            addValue(value);
+    }
+
+    template <typename T>
+    void addScalar(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+        const rdl2::AttributeKey<T> key(attr);
+        addValue(obj.get(key, rdl2::TIMESTEP_BEGIN));
+        if (attr.isBlurrable())
+            addValue(obj.get(key, rdl2::TIMESTEP_END));
+    }
+
+    template <typename V>
+    void addVector(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+        const V& values = obj.get(rdl2::AttributeKey<V>(attr));
+        mHasher.add(static_cast<uint64_t>(std::distance(values.begin(), values.end())));
+        addElements(values, IsPackedVector<V>());
+    }
+
+    void addAttribute(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+    {
+#define SCALAR(TYPE, T) case rdl2::TYPE: addScalar<T>(obj, attr); break;
+#define VECTOR(TYPE, V) case rdl2::TYPE: addVector<V>(obj, attr); break;
+        switch (attr.getType()) {
+            SCALAR(TYPE_BOOL,   rdl2::Bool)
+            SCALAR(TYPE_INT,    rdl2::Int)
+            SCALAR(TYPE_LONG,   rdl2::Long)
+            SCALAR(TYPE_FLOAT,  rdl2::Float)
+            SCALAR(TYPE_DOUBLE, rdl2::Double)
+            SCALAR(TYPE_STRING, rdl2::String)
+            SCALAR(TYPE_RGB,    rdl2::Rgb)
+            SCALAR(TYPE_RGBA,   rdl2::Rgba)
+            SCALAR(TYPE_VEC2F,  rdl2::Vec2f)
+            SCALAR(TYPE_VEC2D,  rdl2::Vec2d)
+            SCALAR(TYPE_VEC3F,  rdl2::Vec3f)
+            SCALAR(TYPE_VEC3D,  rdl2::Vec3d)
+            SCALAR(TYPE_VEC4F,  rdl2::Vec4f)
+            SCALAR(TYPE_VEC4D,  rdl2::Vec4d)
+            SCALAR(TYPE_MAT4F,  rdl2::Mat4f)
+            SCALAR(TYPE_MAT4D,  rdl2::Mat4d)
+            case rdl2::TYPE_SCENE_OBJECT:
+                addValue(obj.get(rdl2::AttributeKey<rdl2::SceneObject*>(attr)));
+                break;
+            VECTOR(TYPE_BOOL_VECTOR,   rdl2::BoolVector)
+            VECTOR(TYPE_INT_VECTOR,    rdl2::IntVector)
+            VECTOR(TYPE_LONG_VECTOR,   rdl2::LongVector)
+            VECTOR(TYPE_FLOAT_VECTOR,  rdl2::FloatVector)
+            VECTOR(TYPE_DOUBLE_VECTOR, rdl2::DoubleVector)
+            VECTOR(TYPE_STRING_VECTOR, rdl2::StringVector)
+            VECTOR(TYPE_RGB_VECTOR,    rdl2::RgbVector)
+            VECTOR(TYPE_RGBA_VECTOR,   rdl2::RgbaVector)
+            VECTOR(TYPE_VEC2F_VECTOR,  rdl2::Vec2fVector)
+            VECTOR(TYPE_VEC2D_VECTOR,  rdl2::Vec2dVector)
+            VECTOR(TYPE_VEC3F_VECTOR,  rdl2::Vec3fVector)
+            VECTOR(TYPE_VEC3D_VECTOR,  rdl2::Vec3dVector)
+            VECTOR(TYPE_VEC4F_VECTOR,  rdl2::Vec4fVector)
+            VECTOR(TYPE_VEC4D_VECTOR,  rdl2::Vec4dVector)
+            VECTOR(TYPE_MAT4F_VECTOR,  rdl2::Mat4fVector)
+            VECTOR(TYPE_MAT4D_VECTOR,  rdl2::Mat4dVector)
+            VECTOR(TYPE_SCENE_OBJECT_VECTOR,    rdl2::SceneObjectVector)
+            VECTOR(TYPE_SCENE_OBJECT_INDEXABLE, rdl2::SceneObjectIndexable)
+            default:
+                break;
+        }
+#undef SCALAR
+#undef VECTOR
+    }
+
+    Murmur3Hasher mHasher;
+    bool mIncludeBindings;
+    std::vector<const rdl2::SceneObject*>* mRefs;
+};
+
+// ---------------------------------------------------------------------------
+// Merkle combination over the reference graph
+// ---------------------------------------------------------------------------
+struct ReferenceGraph
+{
+    std::vector<const rdl2::SceneObject*> objects;
+    std::vector<Hash128> local;
+    std::vector<std::vector<size_t>> edges;  // indices into objects, no self-edges
+};
+
+// Hashes `roots` and, when `recursive`, everything they reach, breadth-first
+// so that each level is hashed in parallel.
+static ReferenceGraph buildGraph(const std::vector<const rdl2::SceneObject*>& roots,
+                                 bool includeBindings, bool recursive)
+{
+    ReferenceGraph graph;
+    std::unordered_map<const rdl2::SceneObject*, size_t> indices;
+    for (const rdl2::SceneObject* obj : roots)
+        if (indices.emplace(obj, graph.objects.size()).second)
+            graph.objects.push_back(obj);
+
+    std::vector<std::vector<const rdl2::SceneObject*>> refs;
+    size_t levelBegin = 0;
+    while (levelBegin < graph.objects.size()) {
+        const size_t levelEnd = graph.objects.size();
+        graph.local.resize(levelEnd);
+        refs.resize(levelEnd);
+        tbb::parallel_for(tbb::blocked_range<size_t>(levelBegin, levelEnd, 64),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    ObjectHasher hasher(includeBindings, recursive ? &refs[i] : nullptr);
+                    graph.local[i] = hasher.hash(*graph.objects[i]);
+                }
+            });
+        for (size_t i = levelBegin; i < levelEnd; ++i)
+            for (const rdl2::SceneObject* ref : refs[i])
+                if (indices.emplace(ref, graph.objects.size()).second)
+                    graph.objects.push_back(ref);
+        levelBegin = levelEnd;
+    }
+
+    graph.edges.resize(graph.objects.size());
+    for (size_t i = 0; i < refs.size(); ++i)
+        for (const rdl2::SceneObject* ref : refs[i]) {
+            const size_t target = indices[ref];
+            if (target != i)
+                graph.edges[i].push_back(target);
+        }
+    return graph;
+}
+
+// Tarjan's algorithm, iteratively.  Components are finished in reverse
+// topological order, so every edge leaving a component points at objects
+// whose recursive hashes are already known.
+static std::vector<Hash128> merkleHashes(const ReferenceGraph& graph)
+{
+    const size_t n = graph.objects.size();
+    const size_t kUnvisited = static_cast<size_t>(-1);
+    std::vector<size_t> order(n, kUnvisited), low(n), component(n, kUnvisited);
+    std::vector<bool> onStack(n, false);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> calls;  // (object, next edge)
+    std::vector<Hash128> merkle(n);
+    size_t counter = 0, components = 0;
+
+    auto finish = [&](std::vector<size_t>& members) {
+        if (members.size() == 1) {
+            const size_t v = members[0];
+            Murmur3Hasher h;
+            h.add('o');
+            h.addHash(graph.local[v]);
+            for (size_t w : graph.edges[v])
+                h.addHash(merkle[w]);
+            merkle[v] = h.digest();
+            return;
+        }
+        std::sort(members.begin(), members.end(), [&](size_t a, size_t b) {
+            return graph.objects[a]->getName() < graph.objects[b]->getName();
+        });
+        Murmur3Hasher cycle;
+        cycle.add('c');
+        for (size_t v : members) {
+            cycle.addHash(graph.local[v]);
+            for (size_t w : graph.edges[v])
+                if (component[w] != component[v])
+                    cycle.addHash(merkle[w]);
+        }
+        const Hash128 cycleHash = cycle.digest();
+        for (size_t v : members) {
+            Murmur3Hasher h;
+            h.add('m');
+            h.addHash(graph.local[v]);
+            h.addHash(cycleHash);
+            merkle[v] = h.digest();
+        }
+    };
+
+    auto visit = [&](size_t v) {
+        order[v] = low[v] = counter++;
+        stack.push_back(v);
+        onStack[v] = true;
+        calls.emplace_back(v, 0);
+    };
+
+    for (size_t root = 0; root < n; ++root) {
+        if (order[root] != kUnvisited)
+            continue;
+        visit(root);
+        while (!calls.empty()) {
+            const size_t v = calls.back().first;
+            const size_t e = calls.back().second;
+            if (e < graph.edges[v].size()) {
+                ++calls.back().second;
+                const size_t w = graph.edges[v][e];
+                if (order[w] == kUnvisited)
+                    visit(w);
+                else if (onStack[w])
+                    low[v] = std::min(low[v], order[w]);
+                continue;
+            }
+            calls.pop_back();
+            if (!calls.empty())
+                low[calls.back().first] = std::min(low[calls.back().first], low[v]);
+            if (low[v] != order[v])
+                continue;
+            std::vector<size_t> members;
+            size_t w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                onStack[w] = false;
+                component[w] = components;
+                members.push_back(w);
+            } while (w != v);
+            ++components;
+            finish(members);
+        }
+    }
+    return merkle;
+}
+
+// One hash per entry of `roots`.
+static std::vector<Hash128> hashObjects(const std::vector<const rdl2::SceneObject*>& roots,
+                                        bool includeBindings, bool recursive)
+{
+    const ReferenceGraph graph = buildGraph(roots, includeBindings, recursive);
+    const std::vector<Hash128> hashes = recursive ? merkleHashes(graph) : graph.local;
+    // buildGraph() drops duplicate roots, so map back by object.
+    std::unordered_map<const rdl2::SceneObject*, size_t> indices;
+    for (size_t i = 0; i < graph.objects.size(); ++i)
+        indices.emplace(graph.objects[i], i);
+    std::vector<Hash128> result;
+    result.reserve(roots.size());
+    for (const rdl2::SceneObject* obj : roots)
+        result.push_back(hashes[indices[obj]]);
+    return result;
+}
+
+std::string contentHash(const rdl2::SceneObject& obj, bool includeBindings, bool recursive)
+{
+    py::gil_scoped_release release;
+    return hashObjects({&obj}, includeBindings, recursive)[0].hex();
+}
+
+py::dict hashAll(const rdl2::SceneContext& ctx, bool includeBindings, bool recursive)
+{
+    std::vector<const rdl2::SceneObject*> objects;
+    std::vector<Hash128> hashes;
+    {
+        py::gil_scoped_release release;
+        for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+            objects.push_back(it->second);
+        hashes = hashObjects(objects, includeBindings, recursive);
+    }
+    py::dict result;
+    for (size_t i = 0; i < objects.size(); ++i)
+        result[py::str(objects[i]->getName())] = py::str(hashes[i].hex());
+    return result;
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Reader/writer wrappers and stream helpers shared by the I/O and snapshot
+// bindings.
+// Included by the bind_*.cpp files that load into or write out a SceneContext.
+
+#pragma once
+
+#include "bindings.h"
+#include "frame_codec.h"
+
+#include <string>
+
+// Encodes (manifest, payload) as a framed-stream frame (frame_codec.h) and
+// writes it to a binary file-like object via write().  The buffers are moved
+// into Python-owned memoryviews rather than copied, so the writer may keep
+// what it is given.  Returns the frame size in bytes.  Implemented in
+// bind_io.cpp.
+uint64_t writeFrameToStream(py::handle writer, std::string&& manifest, std::string&& payload,
+                            int level = 0, uint64_t chunkSize = kDefaultChunkSize);
+
+// Marks ctx's cached SceneObject index (see bind_scene_context.cpp) stale.
+// Call before any binding that may create SceneObjects in ctx.  Requires the
+// GIL.
+void invalidateSceneIndex(const rdl2::SceneContext& ctx);
+
+// Calls invalidateSceneIndex(ctx) on scope exit, so a load that fails
+// part-way through still marks the index stale.  Declare it before any
+// py::gil_scoped_release, so that it runs with the GIL held again.
+class InvalidateSceneIndexOnExit
+{
+public:
+    explicit InvalidateSceneIndexOnExit(const rdl2::SceneContext& ctx) : mContext(ctx) {}
+    ~InvalidateSceneIndexOnExit() { invalidateSceneIndex(mContext); }
+    InvalidateSceneIndexOnExit(const InvalidateSceneIndexOnExit&) = delete;
+    InvalidateSceneIndexOnExit& operator=(const InvalidateSceneIndexOnExit&) = delete;
+
+private:
+    const rdl2::SceneContext& mContext;
+};
+
+// The types bound as AsciiReader and BinaryReader.  rdl2 readers keep their
+// SceneContext private; these remember it so loads can invalidate its index.
+template <typename Reader>
+class ContextReader : public Reader
+{
+public:
+    explicit ContextReader(rdl2::SceneContext& ctx) : Reader(ctx), mContext(ctx) {}
+    rdl2::SceneContext& getContext() const { return mContext; }
+
+private:
+    rdl2::SceneContext& mContext;
+};
+using BoundAsciiReader  = ContextReader<rdl2::AsciiReader>;
+using BoundBinaryReader = ContextReader<rdl2::BinaryReader>;
+
+// The type bound as BinaryWriter.  Remembers its SceneContext for writers
+// that bypass rdl2's own encoder, such as writeIndexedFile.
+class BoundBinaryWriter : public rdl2::BinaryWriter
+{
+public:
+    explicit BoundBinaryWriter(const rdl2::SceneContext& ctx)
+        : rdl2::BinaryWriter(ctx), mContext(ctx) {}
+    const rdl2::SceneContext& getContext() const { return mContext; }
+
+private:
+    const rdl2::SceneContext& mContext;
+};
+
+// Shared-memory snapshots — implemented in bind_snapshot.cpp.  exportSnapshot
+// returns a SceneSnapshot; a None name picks a unique one.  The context
+// returned by contextFromSnapshot is owned by the caller.
+py::object exportSnapshot(const rdl2::SceneContext& ctx, py::object name);
+void readSnapshot(BoundBinaryReader& reader, const std::string& name);
+rdl2::SceneContext* contextFromSnapshot(const std::string& name, py::object dsoPath);
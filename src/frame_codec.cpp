@@ -0,0 +1,190 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Framed-stream frame bodies: plain, or split into independently compressed
+// zstd chunks (see stream_format.h).  zstd is vendored under third_party/zstd
+// and built with the module, so no system library is needed.
+
+#include "frame_codec.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// FrameChunks: addresses the manifest followed by the payload as one run of
+// bytes, cut into chunks of a fixed size.  A chunk that straddles the two
+// buffers has to be staged through a temporary.
+// ---------------------------------------------------------------------------
+
+class FrameChunks
+{
+public:
+    FrameChunks(uint64_t manifestSize, uint64_t payloadSize, uint64_t chunkSize)
+        : mManifestSize(manifestSize),
+          mTotal(manifestSize + payloadSize),
+          mChunkSize(chunkSize)
+    {}
+
+    uint64_t count() const { return mTotal / mChunkSize + (mTotal % mChunkSize != 0); }
+    uint64_t begin(uint64_t i) const { return i * mChunkSize; }
+    uint64_t length(uint64_t i) const { return std::min(mChunkSize, mTotal - begin(i)); }
+
+    bool straddles(uint64_t i) const
+    {
+        return begin(i) < mManifestSize && begin(i) + length(i) > mManifestSize;
+    }
+
+    // Where chunk i starts in whichever buffer holds it (not for straddlers).
+    template <typename Char>
+    Char* locate(uint64_t i, Char* manifest, Char* payload) const
+    {
+        return begin(i) < mManifestSize ? manifest + begin(i)
+                                        : payload + (begin(i) - mManifestSize);
+    }
+
+    uint64_t manifestPart(uint64_t i) const { return mManifestSize - begin(i); }
+
+private:
+    uint64_t mManifestSize;
+    uint64_t mTotal;
+    uint64_t mChunkSize;
+};
+
+// Each chunk carries zstd's content checksum, so damage is caught on decode
+// (as zlib's adler32 did) rather than handed to rdl2.
+static std::string compressChunk(const char* data, uint64_t size, int level)
+{
+    std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx*)> cctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
+    if (!cctx)
+        throw std::bad_alloc();
+    std::string out(ZSTD_compressBound(size), '\0');
+    size_t rc = ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, level);
+    if (!ZSTD_isError(rc))
+        rc = ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_checksumFlag, 1);
+    if (!ZSTD_isError(rc))
+        rc = ZSTD_compress2(cctx.get(), &out[0], out.size(), data, size);
+    if (ZSTD_isError(rc))
+        throw std::runtime_error(std::string("zstd compression failed: ") +
+                                 ZSTD_getErrorName(rc));
+    out.resize(rc);
+    return out;
+}
+
+static void decompressChunk(const char* data, uint64_t size, char* out, uint64_t outSize,
+                            uint64_t index)
+{
+    const size_t rc = ZSTD_decompress(out, outSize, data, size);
+    if (ZSTD_isError(rc) || rc != outSize)
+        throw std::runtime_error("corrupt RDL binary stream: compressed chunk " +
+                                 std::to_string(index) + " does not decompress");
+}
+
+static void appendLE(std::string& out, uint64_t value)
+{
+    unsigned char buf[8];
+    frame_detail::putLE(buf, value, 8);
+    out.append(reinterpret_cast<const char*>(buf), 8);
+}
+
+EncodedFrame encodeFrame(const std::string& manifest, const std::string& payload,
+                         int level, uint64_t chunkSize)
+{
+    if (level < 0 || level > kMaxCompressionLevel)
+        throw std::invalid_argument("compression level must be between 0 and " +
+                                    std::to_string(kMaxCompressionLevel) + ", got " +
+                                    std::to_string(level));
+    if (chunkSize == 0 || chunkSize > kMaxFrameChunkSize)
+        throw std::invalid_argument("compressed chunk size must be between 1 and " +
+                                    std::to_string(kMaxFrameChunkSize) + " bytes");
+
+    FrameHeader header;
+    header.flags = level ? kFrameZstd : 0;
+    header.manifestSize = manifest.size();
+    header.payloadSize = payload.size();
+    EncodedFrame frame;
+    frame.head.resize(kFrameHeaderSize);
+    encodeFrameHeader(header, &frame.head[0]);
+    if (!level) {
+        frame.manifest = &manifest;
+        frame.payload = &payload;
+        return frame;
+    }
+
+    const FrameChunks layout(manifest.size(), payload.size(), chunkSize);
+    std::vector<std::string> chunks(layout.count());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size(), 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                if (layout.straddles(i)) {
+                    std::string staged(manifest, layout.begin(i));
+                    staged.append(payload, 0, layout.length(i) - staged.size());
+                    chunks[i] = compressChunk(staged.data(), staged.size(), level);
+                } else {
+                    chunks[i] = compressChunk(layout.locate(i, manifest.data(), payload.data()),
+                                              layout.length(i), level);
+                }
+            }
+        });
+
+    size_t compressedSize = 0;
+    for (const std::string& chunk : chunks)
+        compressedSize += chunk.size();
+    frame.head.reserve(kFrameHeaderSize + 8 + 8 * chunks.size() + compressedSize);
+    appendLE(frame.head, chunkSize);
+    for (const std::string& chunk : chunks)
+        appendLE(frame.head, chunk.size());
+    for (const std::string& chunk : chunks)
+        frame.head.append(chunk);
+    return frame;
+}
+
+void decodeFrameBody(const FrameHeader& header, const char* body, uint64_t bodySize,
+                     std::string& manifest, std::string& payload)
+{
+    if (!header.compressed()) {
+        if (header.manifestSize > bodySize || header.payloadSize > bodySize - header.manifestSize)
+            throw std::runtime_error("truncated RDL binary stream: frame is incomplete");
+        manifest.assign(body, header.manifestSize);
+        payload.assign(body + header.manifestSize, header.payloadSize);
+        return;
+    }
+
+    // Validates the chunk table, and bounds the sizes allocated below by what
+    // the chunks can decompress to.
+    compressedBodySize(header, body, bodySize);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(body);
+    const uint64_t chunkSize = frame_detail::getLE(bytes, 8);
+    const uint64_t count = frameChunkCount(header, chunkSize);
+    std::vector<uint64_t> offsets(count + 1, 8 + 8 * count);
+    for (uint64_t i = 0; i < count; ++i)
+        offsets[i + 1] = offsets[i] + frame_detail::getLE(bytes + 8 + 8 * i, 8);
+
+    manifest.resize(header.manifestSize);
+    payload.resize(header.payloadSize);
+    const FrameChunks layout(header.manifestSize, header.payloadSize, chunkSize);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const char* in = body + offsets[i];
+                const uint64_t inSize = offsets[i + 1] - offsets[i];
+                if (layout.straddles(i)) {
+                    std::string staged(layout.length(i), '\0');
+                    decompressChunk(in, inSize, &staged[0], staged.size(), i);
+                    const uint64_t split = layout.manifestPart(i);
+                    std::copy(staged.begin(), staged.begin() + split,
+                              manifest.begin() + layout.begin(i));
+                    std::copy(staged.begin() + split, staged.end(), payload.begin());
+                } else {
+                    decompressChunk(in, inSize, layout.locate(i, &manifest[0], &payload[0]),
+                                    layout.length(i), i);
+                }
+            }
+        });
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Encoding and decoding of framed-stream frame bodies (see stream_format.h),
+// including the zstd-compressed form.  Chunks of a compressed frame are
+// compressed and decompressed in parallel with TBB.  Implemented in frame_codec.cpp;
+// none of these functions touch Python, so they may run without the GIL.
+
+#pragma once
+
+#include "stream_format.h"
+
+#include <cstdint>
+#include <string>
+
+// Chunk size used when the caller does not pick one.  Large enough for
+// zstd to find long-range repeats, small enough to keep every core busy
+// on frames of a few tens of MB.
+constexpr uint64_t kDefaultChunkSize = uint64_t(4) << 20;
+
+// A frame ready to be written: `head` followed by `manifest` and `payload`.
+// For an uncompressed frame `head` is just the header and the two buffers
+// are the caller's; for a compressed one `head` holds the whole frame and
+// both pointers are null.
+struct EncodedFrame
+{
+    std::string head;
+    const std::string* manifest = nullptr;
+    const std::string* payload = nullptr;
+
+    uint64_t size() const
+    {
+        return head.size() + (manifest ? manifest->size() : 0) + (payload ? payload->size() : 0);
+    }
+};
+
+// Highest `level` accepted by encodeFrame.  zstd's levels above 19 need
+// far more memory to decompress, so they are not offered.
+constexpr int kMaxCompressionLevel = 19;
+
+// Frames (manifest, payload).  `level` 0 leaves the frame uncompressed;
+// 1-19 are zstd levels.  Throws std::invalid_argument on a bad level or chunk
+// size.  The buffers must outlive the returned EncodedFrame.
+EncodedFrame encodeFrame(const std::string& manifest, const std::string& payload,
+                         int level = 0, uint64_t chunkSize = kDefaultChunkSize);
+
+// Extracts the manifest and payload from a frame body of `bodySize` bytes
+// (everything after the header), decompressing it if the frame is compressed.
+// Throws std::runtime_error if the body is damaged.
+void decodeFrameBody(const FrameHeader& header, const char* body, uint64_t bodySize,
+                     std::string& manifest, std::string& payload);
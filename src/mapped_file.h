@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Read-only memory mapping of a whole file.
+//
+// Pages are faulted in only when touched, so a reader that scans frame
+// headers and decodes a subset of a large file keeps its RSS proportional to
+// what it reads.  release() hands pages that have been consumed back to the
+// kernel; they are re-read from the file if touched again.
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& path)
+    {
+        mFd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (mFd < 0)
+            throw std::system_error(errno, std::generic_category(),
+                                    "open('" + path + "') failed");
+        struct stat st;
+        if (::fstat(mFd, &st) != 0) {
+            const int err = errno;
+            ::close(mFd);
+            throw std::system_error(err, std::generic_category(), "fstat() failed");
+        }
+        mSize = static_cast<size_t>(st.st_size);
+        if (mSize == 0)
+            return;  // mmap() rejects empty mappings
+        void* data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFd, 0);
+        if (data == MAP_FAILED) {
+            const int err = errno;
+            ::close(mFd);
+            throw std::system_error(err, std::generic_category(), "mmap() failed");
+        }
+        mData = static_cast<const char*>(data);
+    }
+
+    ~MappedFile()
+    {
+        if (mData)
+            ::munmap(const_cast<char*>(mData), mSize);
+        ::close(mFd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return mData; }
+    size_t size() const { return mSize; }
+
+    // Hint that the file will be read front to back (more read-ahead).
+    void adviseSequential() const
+    {
+        if (mData)
+            ::madvise(const_cast<char*>(mData), mSize, MADV_SEQUENTIAL);
+    }
+
+    // Drops the whole pages inside [offset, offset + size) from this
+    // process's resident set.  Advisory; failures are ignored.
+    void release(uint64_t offset, uint64_t size) const
+    {
+        const uint64_t page = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        const uint64_t begin = (offset + page - 1) / page * page;
+        const uint64_t end = (offset + size) / page * page;
+        if (mData && end > begin)
+            ::madvise(const_cast<char*>(mData) + begin, end - begin, MADV_DONTNEED);
+    }
+
+private:
+    int mFd = -1;
+    const char* mData = nullptr;
+    size_t mSize = 0;
+};
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// SceneObject.memoryUsage() and SceneContext.memoryReport(): estimated bytes
+// held by attribute values, computed in C++.
+//
+// Each attribute is charged its inline storage (both timesteps for blurrable
+// attributes, plus the binding pointer for bindable ones) and the heap memory
+// its value owns: vector capacity, string capacity beyond the small-string
+// buffer, and the strings inside a StringVector.  UserData keeps its channels
+// in vector attributes, so they are counted like any other attribute.  rdl2's
+// own bookkeeping (SceneObject headers, SceneClass tables) is not counted.
+//
+// memoryReport() walks the objects in parallel with TBB.  The context must not
+// be modified while it runs.
+
+#include "bindings.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <map>
+
+// ---------------------------------------------------------------------------
+// Heap bytes owned by a value
+// ---------------------------------------------------------------------------
+template <typename T>
+static uint64_t heapBytes(const T&) { return 0; }
+
+static uint64_t heapBytes(const std::string& s)
+{
+    static const size_t kInlineCapacity = std::string().capacity();
+    return s.capacity() > kInlineCapacity ? s.capacity() + 1 : 0;
+}
+
+template <typename E, typename A>
+static uint64_t heapBytes(const std::vector<E, A>& values)
+{
+    return values.capacity() * sizeof(E);
+}
+
+template <typename A>
+static uint64_t heapBytes(const std::vector<std::string, A>& values)
+{
+    uint64_t bytes = values.capacity() * sizeof(std::string);
+    for (const std::string& s : values)
+        bytes += heapBytes(s);
+    return bytes;
+}
+
+// Block overhead is not counted.
+template <typename E, typename A>
+static uint64_t heapBytes(const std::deque<E, A>& values)
+{
+    return values.size() * sizeof(E);
+}
+
+// Elements only; the lookup index is not counted.
+static uint64_t heapBytes(const rdl2::SceneObjectIndexable& values)
+{
+    return std::distance(values.begin(), values.end()) * sizeof(rdl2::SceneObject*);
+}
+
+// ---------------------------------------------------------------------------
+// Per-attribute usage
+// ---------------------------------------------------------------------------
+template <typename T>
+static uint64_t scalarUsage(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+{
+    const rdl2::AttributeKey<T> key(attr);
+    uint64_t bytes = sizeof(T) + heapBytes(obj.get(key, rdl2::TIMESTEP_BEGIN));
+    if (attr.isBlurrable())
+        bytes += sizeof(T) + heapBytes(obj.get(key, rdl2::TIMESTEP_END));
+    return bytes;
+}
+
+template <typename V>
+static uint64_t vectorUsage(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+{
+    return sizeof(V) + heapBytes(obj.get(rdl2::AttributeKey<V>(attr)));
+}
+
+static uint64_t attributeUsage(const rdl2::SceneObject& obj, const rdl2::Attribute& attr)
+{
+    const uint64_t binding = attr.isBindable() ? sizeof(rdl2::SceneObject*) : 0;
+
+#define SCALAR(TYPE, T) case rdl2::TYPE: return binding + scalarUsage<T>(obj, attr);
+#define VECTOR(TYPE, V) case rdl2::TYPE: return binding + vectorUsage<V>(obj, attr);
+    switch (attr.getType()) {
+        SCALAR(TYPE_BOOL,   rdl2::Bool)
+        SCALAR(TYPE_INT,    rdl2::Int)
+        SCALAR(TYPE_LONG,   rdl2::Long)
+        SCALAR(TYPE_FLOAT,  rdl2::Float)
+        SCALAR(TYPE_DOUBLE, rdl2::Double)
+        SCALAR(TYPE_STRING, rdl2::String)
+        SCALAR(TYPE_RGB,    rdl2::Rgb)
+        SCALAR(TYPE_RGBA,   rdl2::Rgba)
+        SCALAR(TYPE_VEC2F,  rdl2::Vec2f)
+        SCALAR(TYPE_VEC2D,  rdl2::Vec2d)
+        SCALAR(TYPE_VEC3F,  rdl2::Vec3f)
+        SCALAR(TYPE_VEC3D,  rdl2::Vec3d)
+        SCALAR(TYPE_VEC4F,  rdl2::Vec4f)
+        SCALAR(TYPE_VEC4D,  rdl2::Vec4d)
+        SCALAR(TYPE_MAT4F,  rdl2::Mat4f)
+        SCALAR(TYPE_MAT4D,  rdl2::Mat4d)
+        SCALAR(TYPE_SCENE_OBJECT, rdl2::SceneObject*)
+        VECTOR(TYPE_BOOL_VECTOR,   rdl2::BoolVector)
+        VECTOR(TYPE_INT_VECTOR,    rdl2::IntVector)
+        VECTOR(TYPE_LONG_VECTOR,   rdl2::LongVector)
+        VECTOR(TYPE_FLOAT_VECTOR,  rdl2::FloatVector)
+        VECTOR(TYPE_DOUBLE_VECTOR, rdl2::DoubleVector)
+        VECTOR(TYPE_STRING_VECTOR, rdl2::StringVector)
+        VECTOR(TYPE_RGB_VECTOR,    rdl2::RgbVector)
+        VECTOR(TYPE_RGBA_VECTOR,   rdl2::RgbaVector)
+        VECTOR(TYPE_VEC2F_VECTOR,  rdl2::Vec2fVector)
+        VECTOR(TYPE_VEC2D_VECTOR,  rdl2::Vec2dVector)
+        VECTOR(TYPE_VEC3F_VECTOR,  rdl2::Vec3fVector)
+        VECTOR(TYPE_VEC3D_VECTOR,  rdl2::Vec3dVector)
+        VECTOR(TYPE_VEC4F_VECTOR,  rdl2::Vec4fVector)
+        VECTOR(TYPE_VEC4D_VECTOR,  rdl2::Vec4dVector)
+        VECTOR(TYPE_MAT4F_VECTOR,  rdl2::Mat4fVector)
+        VECTOR(TYPE_MAT4D_VECTOR,  rdl2::Mat4dVector)
+        VECTOR(TYPE_SCENE_OBJECT_VECTOR,    rdl2::SceneObjectVector)
+        VECTOR(TYPE_SCENE_OBJECT_INDEXABLE, rdl2::SceneObjectIndexable)
+        default:
+            return binding;
+    }
+#undef SCALAR
+#undef VECTOR
+}
+
+// Usage of every attribute of `obj`, in declaration order.
+static std::vector<uint64_t> objectUsage(const rdl2::SceneObject& obj)
+{
+    const rdl2::SceneClass& sc = obj.getSceneClass();
+    std::vector<uint64_t> usage;
+    for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it)
+        usage.push_back(attributeUsage(obj, **it));
+    return usage;
+}
+
+// Largest first; ties in key order.
+static py::dict sortedBySize(const std::map<std::string, uint64_t>& totals)
+{
+    std::vector<std::pair<std::string, uint64_t>> entries(totals.begin(), totals.end());
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const std::pair<std::string, uint64_t>& a,
+                        const std::pair<std::string, uint64_t>& b) { return a.second > b.second; });
+    py::dict result;
+    for (const auto& entry : entries)
+        result[py::str(entry.first)] = entry.second;
+    return result;
+}
+
+py::object memoryUsage(const rdl2::SceneObject& obj, bool byAttribute)
+{
+    std::vector<uint64_t> usage;
+    {
+        py::gil_scoped_release release;
+        usage = objectUsage(obj);
+    }
+    if (!byAttribute) {
+        uint64_t total = 0;
+        for (uint64_t bytes : usage)
+            total += bytes;
+        return py::int_(total);
+    }
+    std::map<std::string, uint64_t> totals;
+    const rdl2::SceneClass& sc = obj.getSceneClass();
+    size_t i = 0;
+    for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it, ++i)
+        totals[(*it)->getName()] = usage[i];
+    return sortedBySize(totals);
+}
+
+py::dict memoryReport(const rdl2::SceneContext& ctx, const std::string& groupBy)
+{
+    enum class Group { Class, AttributeType, Object };
+    Group group;
+    if (groupBy == "class")
+        group = Group::Class;
+    else if (groupBy == "attribute_type")
+        group = Group::AttributeType;
+    else if (groupBy == "object")
+        group = Group::Object;
+    else
+        throw py::value_error("memoryReport() group_by must be 'class', "
+                              "'attribute_type' or 'object'");
+
+    std::map<std::string, uint64_t> totals;
+    {
+        py::gil_scoped_release release;
+        std::vector<const rdl2::SceneObject*> objects;
+        for (auto it = ctx.beginSceneObject(); it != ctx.endSceneObject(); ++it)
+            objects.push_back(it->second);
+
+        std::vector<std::vector<uint64_t>> usage(objects.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, objects.size(), 64),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    usage[i] = objectUsage(*objects[i]);
+            });
+
+        for (size_t i = 0; i < objects.size(); ++i) {
+            const rdl2::SceneClass& sc = objects[i]->getSceneClass();
+            if (group == Group::AttributeType) {
+                size_t a = 0;
+                for (auto it = sc.beginAttributes(); it != sc.endAttributes(); ++it, ++a)
+                    totals[rdl2::attributeTypeName((*it)->getType())] += usage[i][a];
+                continue;
+            }
+            uint64_t total = 0;
+            for (uint64_t bytes : usage[i])
+                total += bytes;
+            totals[group == Group::Class ? sc.getName() : objects[i]->getName()] += total;
+        }
+    }
+    return sortedBySize(totals);
+}
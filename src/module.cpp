@@ -13,7 +13,8 @@ PYBIND11_MODULE(scene_rdl2, m) {
     bind_math(m);
     bind_types(m);
     bind_attribute(m);       // Attribute, SceneClass
-    bind_scene_object(m);    // SceneObject, UpdateGuard
+    bind_scene_object(m);    // SceneObject, UpdateBlock
+    bind_attribute_handle(m); // AttributeHandle
     bind_scene_variables(m); // SceneVariables
     bind_node(m);            // Node, Camera, Geometry
     bind_light(m);           // Light
@@ -21,6 +22,13 @@ PYBIND11_MODULE(scene_rdl2, m) {
     bind_sets(m);            // GeometrySet, LightSet
     bind_layer(m);           // LayerAssignment, Layer
     bind_render_output(m);   // RenderOutput (+ nested enums)
+    bind_snapshot(m);        // SceneSnapshot
+    bind_archive(m);         // ArchiveEntry
+    bind_dependency_graph(m); // DependencyGraph
     bind_scene_context(m);   // SceneContext
     bind_io(m);              // AsciiReader, AsciiWriter, free functions
+    bind_change_tracker(m);  // ChangeTracker
+    bind_validate(m);        // ValidationIssue, validate()
+    bind_diff(m);            // SceneDiff, diff()
+    bind_profiling(m);       // profiling submodule
 }
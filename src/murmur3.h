@@ -0,0 +1,156 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Incremental MurmurHash3_x64_128.
+//
+// Feeding a byte sequence through any number of update() calls and then
+// digest() gives the same result as Austin Appleby's one-shot
+// MurmurHash3_x64_128 over the whole sequence.  Input is read in native byte
+// order, as in the reference implementation, so digests are only comparable
+// between little-endian hosts.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+struct Hash128
+{
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    bool operator==(const Hash128& o) const { return h1 == o.h1 && h2 == o.h2; }
+    bool operator!=(const Hash128& o) const { return !(*this == o); }
+    bool operator<(const Hash128& o) const { return h1 != o.h1 ? h1 < o.h1 : h2 < o.h2; }
+
+    // 32 lowercase hex digits, h1 first.
+    std::string hex() const
+    {
+        static const char kDigits[] = "0123456789abcdef";
+        std::string out(32, '0');
+        for (int i = 0; i < 16; ++i) {
+            out[15 - i] = kDigits[(h1 >> (4 * i)) & 0xf];
+            out[31 - i] = kDigits[(h2 >> (4 * i)) & 0xf];
+        }
+        return out;
+    }
+};
+
+class Murmur3Hasher
+{
+public:
+    explicit Murmur3Hasher(uint32_t seed = 0) : mH1(seed), mH2(seed) {}
+
+    void update(const void* data, size_t size)
+    {
+        const unsigned char* in = static_cast<const unsigned char*>(data);
+        mLength += size;
+        if (mBuffered) {
+            const size_t take = size < kBlock - mBuffered ? size : kBlock - mBuffered;
+            std::memcpy(mBuffer + mBuffered, in, take);
+            mBuffered += take;
+            in += take;
+            size -= take;
+            if (mBuffered < kBlock)
+                return;
+            block(mBuffer);
+            mBuffered = 0;
+        }
+        for (; size >= kBlock; in += kBlock, size -= kBlock)
+            block(in);
+        std::memcpy(mBuffer, in, size);
+        mBuffered = size;
+    }
+
+    template <typename T>
+    void add(const T& value) { update(&value, sizeof(T)); }
+
+    // Length-prefixed, so adjacent strings cannot run together.
+    void addString(const std::string& s)
+    {
+        add(static_cast<uint64_t>(s.size()));
+        update(s.data(), s.size());
+    }
+
+    void addHash(const Hash128& h)
+    {
+        add(h.h1);
+        add(h.h2);
+    }
+
+    // Does not modify the hasher, so more input may follow.
+    Hash128 digest() const
+    {
+        uint64_t h1 = mH1, h2 = mH2;
+        uint64_t k1 = 0, k2 = 0;
+        const unsigned char* tail = mBuffer;
+        switch (mBuffered) {
+        case 15: k2 ^= uint64_t(tail[14]) << 48;  // fall through
+        case 14: k2 ^= uint64_t(tail[13]) << 40;  // fall through
+        case 13: k2 ^= uint64_t(tail[12]) << 32;  // fall through
+        case 12: k2 ^= uint64_t(tail[11]) << 24;  // fall through
+        case 11: k2 ^= uint64_t(tail[10]) << 16;  // fall through
+        case 10: k2 ^= uint64_t(tail[9]) << 8;    // fall through
+        case  9: k2 ^= uint64_t(tail[8]);
+                 k2 *= kC2; k2 = rotl(k2, 33); k2 *= kC1; h2 ^= k2;
+                 // fall through
+        case  8: k1 ^= uint64_t(tail[7]) << 56;   // fall through
+        case  7: k1 ^= uint64_t(tail[6]) << 48;   // fall through
+        case  6: k1 ^= uint64_t(tail[5]) << 40;   // fall through
+        case  5: k1 ^= uint64_t(tail[4]) << 32;   // fall through
+        case  4: k1 ^= uint64_t(tail[3]) << 24;   // fall through
+        case  3: k1 ^= uint64_t(tail[2]) << 16;   // fall through
+        case  2: k1 ^= uint64_t(tail[1]) << 8;    // fall through
+        case  1: k1 ^= uint64_t(tail[0]);
+                 k1 *= kC1; k1 = rotl(k1, 31); k1 *= kC2; h1 ^= k1;
+        }
+
+        h1 ^= mLength;
+        h2 ^= mLength;
+        h1 += h2;
+        h2 += h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        h1 += h2;
+        h2 += h1;
+        return Hash128{h1, h2};
+    }
+
+private:
+    static constexpr size_t kBlock = 16;
+    static constexpr uint64_t kC1 = 0x87c37b91114253d5ULL;
+    static constexpr uint64_t kC2 = 0x4cf5ad432745937fULL;
+
+    static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    static uint64_t fmix(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    void block(const unsigned char* in)
+    {
+        uint64_t k1, k2;
+        std::memcpy(&k1, in, 8);
+        std::memcpy(&k2, in + 8, 8);
+
+        k1 *= kC1; k1 = rotl(k1, 31); k1 *= kC2; mH1 ^= k1;
+        mH1 = rotl(mH1, 27); mH1 += mH2; mH1 = mH1 * 5 + 0x52dce729;
+
+        k2 *= kC2; k2 = rotl(k2, 33); k2 *= kC1; mH2 ^= k2;
+        mH2 = rotl(mH2, 31); mH2 += mH1; mH2 = mH2 * 5 + 0x38495ab5;
+    }
+
+    uint64_t mH1;
+    uint64_t mH2;
+    uint64_t mLength = 0;
+    unsigned char mBuffer[kBlock];
+    size_t mBuffered = 0;
+};
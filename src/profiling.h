@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Opt-in binding instrumentation (scene_rdl2.profiling).
+//
+// Each instrumented wrapper opens a ProfileScope for its probe.  While
+// profiling is disabled a scope costs one relaxed atomic load; while enabled
+// it adds the call count, elapsed time and any bytes reported with
+// addProfiledBytes() to counters owned by the calling thread.  Totals are
+// summed across threads on demand (see bind_profiling.cpp).  Scopes nest;
+// times are inclusive.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+// X(id, name): one entry per instrumented binding.
+#define SCENE_RDL2_PROBES(X)                                           \
+    X(GetItem,                "SceneObject.__getitem__")               \
+    X(SetItem,                "SceneObject.__setitem__")               \
+    X(HandleGet,              "AttributeHandle.get")                   \
+    X(HandleSet,              "AttributeHandle.set")                   \
+    X(GetMany,                "SceneContext.getMany")                  \
+    X(SetMany,                "SceneContext.setMany")                  \
+    X(UpdateScope,            "UpdateScope")                           \
+    X(AsciiReaderFromFile,    "AsciiReader.fromFile")                  \
+    X(AsciiReaderFromString,  "AsciiReader.fromString")                \
+    X(AsciiWriterToFile,      "AsciiWriter.toFile")                    \
+    X(AsciiWriterToString,    "AsciiWriter.toString")                  \
+    X(BinaryReaderFromFile,   "BinaryReader.fromFile")                 \
+    X(BinaryReaderFromBytes,  "BinaryReader.fromBytes")                \
+    X(BinaryReaderFromStream, "BinaryReader.fromStream")               \
+    X(BinaryReaderStreamFile, "BinaryReader.fromStreamFile")           \
+    X(BinaryWriterToFile,     "BinaryWriter.toFile")                   \
+    X(BinaryWriterToBytes,    "BinaryWriter.toBytes")                  \
+    X(BinaryWriterToStream,   "BinaryWriter.toStream")                 \
+    X(BinaryWriterToFd,       "BinaryWriter.toFileDescriptor")
+
+enum class Probe : uint8_t
+{
+#define SCENE_RDL2_PROBE_ID(id, name) id,
+    SCENE_RDL2_PROBES(SCENE_RDL2_PROBE_ID)
+#undef SCENE_RDL2_PROBE_ID
+    Count
+};
+
+constexpr size_t kProbeCount = static_cast<size_t>(Probe::Count);
+
+extern std::atomic<bool> gProfilingEnabled;
+
+inline bool profilingEnabled()
+{
+    return gProfilingEnabled.load(std::memory_order_relaxed);
+}
+
+// Adds to the calling thread's counters for `probe`.  Implemented in
+// bind_profiling.cpp.
+void recordProfile(Probe probe, uint64_t nanos, uint64_t bytes);
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(Probe probe)
+        : mProbe(probe), mActive(profilingEnabled())
+    {
+        if (mActive) {
+            mParent = current();
+            current() = this;
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+    ~ProfileScope()
+    {
+        if (mActive) {
+            const auto elapsed = std::chrono::steady_clock::now() - mStart;
+            current() = mParent;
+            recordProfile(mProbe,
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                          mBytes);
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    // Innermost active scope on the calling thread, or nullptr.
+    static ProfileScope*& current()
+    {
+        static thread_local ProfileScope* sCurrent = nullptr;
+        return sCurrent;
+    }
+
+    void addBytes(uint64_t bytes) { mBytes += bytes; }
+
+private:
+    Probe mProbe;
+    bool mActive;
+    ProfileScope* mParent = nullptr;
+    uint64_t mBytes = 0;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// Credits `bytes` converted between Python and C++ to the innermost scope.
+inline void addProfiledBytes(uint64_t bytes)
+{
+    if (profilingEnabled())
+        if (ProfileScope* scope = ProfileScope::current())
+            scope->addBytes(bytes);
+}
+
+// Approximate in-memory size of a converted attribute value.
+template <typename T>
+inline size_t convertedBytes(const T&) { return sizeof(T); }
+
+inline size_t convertedBytes(const std::string& value) { return value.size(); }
+
+template <typename E, typename A>
+inline size_t convertedBytes(const std::vector<E, A>& values) { return values.size() * sizeof(E); }
+
+template <typename A>
+inline size_t convertedBytes(const std::vector<std::string, A>& values)
+{
+    size_t bytes = 0;
+    for (const std::string& s : values)
+        bytes += s.size();
+    return bytes;
+}
+
+template <typename E, typename A>
+inline size_t convertedBytes(const std::deque<E, A>& values) { return values.size() * sizeof(E); }
+
+// Credits the size of a converted value; computes nothing while disabled.
+template <typename T>
+inline void addProfiledValue(const T& value)
+{
+    if (profilingEnabled())
+        if (ProfileScope* scope = ProfileScope::current())
+            scope->addBytes(convertedBytes(value));
+}
+
+// ProfileScope for a fixed probe, default-constructible for py::call_guard.
+template <Probe P>
+struct ProfiledCall : ProfileScope
+{
+    ProfiledCall() : ProfileScope(P) {}
+};
@@ -0,0 +1,196 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Framed RDL binary stream format.
+//
+// rdl2's binary encoding is a (manifest, payload) pair that must be decoded
+// in one piece.  A stream is a sequence of such pairs, each one a "frame"
+// that BinaryReader applies on its own (typically a full scene followed by
+// delta-encoded updates, or a scene written in several parts):
+//
+//   offset  size  field
+//   0       4     magic "RDLS"
+//   4       4     flags (uint32, see below; unknown bits are rejected)
+//   8       8     manifest size in bytes (uint64)
+//   16      8     payload size in bytes (uint64)
+//   24      ...   manifest bytes, then payload bytes
+//
+// With kFrameZstd set, the sizes are still the uncompressed ones, and the
+// manifest bytes followed by the payload bytes are split into fixed-size
+// chunks that are compressed independently (so they can be compressed and
+// decompressed in parallel).  The body is then
+//
+//   0       8     uncompressed chunk size (uint64; the last chunk may be shorter)
+//   8       8*n   compressed size of each of the n chunks (uint64)
+//   ...           the zstd frames of the chunks, back to back
+//
+// All integers are little-endian.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr char   kFrameMagic[4]   = {'R', 'D', 'L', 'S'};
+constexpr size_t kFrameHeaderSize = 24;
+
+// Frame flags.
+constexpr uint32_t kFrameZstd       = 1u << 0;  // body is zstd-compressed chunks
+constexpr uint32_t kKnownFrameFlags = kFrameZstd;
+
+// Largest chunk a compressed frame may use.
+constexpr uint64_t kMaxFrameChunkSize = uint64_t(1) << 30;
+
+// A zstd block regenerates at most 128 KiB and takes at least 4 bytes (an
+// RLE block), so a compressed frame whose declared sizes exceed this multiple
+// of its chunk bytes is corrupt.
+constexpr uint64_t kMaxDecompressRatio = 32768;
+
+struct FrameHeader
+{
+    uint32_t flags = 0;
+    uint64_t manifestSize = 0;
+    uint64_t payloadSize = 0;
+
+    bool compressed() const { return (flags & kFrameZstd) != 0; }
+
+    // Size of an uncompressed frame; compressed frames are sized by
+    // compressedBodySize().
+    uint64_t frameSize() const { return kFrameHeaderSize + manifestSize + payloadSize; }
+};
+
+namespace frame_detail {
+
+inline void putLE(unsigned char* out, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+        out[i] = static_cast<unsigned char>(value >> (8 * i));
+}
+
+inline uint64_t getLE(const unsigned char* in, size_t bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    return value;
+}
+
+} // namespace frame_detail
+
+inline void encodeFrameHeader(const FrameHeader& header, char* out)
+{
+    auto* bytes = reinterpret_cast<unsigned char*>(out);
+    std::memcpy(bytes, kFrameMagic, 4);
+    frame_detail::putLE(bytes + 4,  header.flags, 4);
+    frame_detail::putLE(bytes + 8,  header.manifestSize, 8);
+    frame_detail::putLE(bytes + 16, header.payloadSize, 8);
+}
+
+// Returns true if `in` (at least 4 bytes) starts with the frame magic.
+inline bool isFrameMagic(const char* in)
+{
+    return std::memcmp(in, kFrameMagic, 4) == 0;
+}
+
+// Throws std::runtime_error on a bad magic or unknown flags.
+inline FrameHeader decodeFrameHeader(const char* in)
+{
+    if (!isFrameMagic(in))
+        throw std::runtime_error("not an RDL binary stream frame (bad magic)");
+    const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+    FrameHeader header;
+    header.flags        = static_cast<uint32_t>(frame_detail::getLE(bytes + 4, 4));
+    header.manifestSize = frame_detail::getLE(bytes + 8, 8);
+    header.payloadSize  = frame_detail::getLE(bytes + 16, 8);
+    if (header.flags & ~kKnownFrameFlags)
+        throw std::runtime_error("unsupported RDL binary stream frame flags " +
+                                 std::to_string(header.flags));
+    return header;
+}
+
+// Number of chunks a compressed frame with this header is split into.
+// Throws std::runtime_error on a zero chunk size for a non-empty frame.
+inline uint64_t frameChunkCount(const FrameHeader& header, uint64_t chunkSize)
+{
+    if (header.manifestSize > UINT64_MAX - header.payloadSize)
+        throw std::runtime_error("corrupt RDL binary stream: frame sizes overflow");
+    const uint64_t total = header.manifestSize + header.payloadSize;
+    if (total == 0)
+        return 0;
+    if (chunkSize == 0)
+        throw std::runtime_error("corrupt RDL binary stream: zero compressed chunk size");
+    return total / chunkSize + (total % chunkSize != 0);
+}
+
+// Size of the compressed frame body starting at `body`, of which `available`
+// bytes may be read, computed from its chunk table.  Throws
+// std::runtime_error if the chunk table does not fit, or if it cannot expand
+// to the sizes the header declares; callers may then allocate those sizes.
+inline uint64_t compressedBodySize(const FrameHeader& header, const char* body,
+                                   uint64_t available)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(body);
+    if (available < 8)
+        throw std::runtime_error("truncated RDL binary stream: incomplete chunk table");
+    const uint64_t chunkSize = frame_detail::getLE(bytes, 8);
+    const uint64_t count = frameChunkCount(header, chunkSize);
+    if (count != 0 && chunkSize > kMaxFrameChunkSize)
+        throw std::runtime_error("corrupt RDL binary stream: compressed chunk size " +
+                                 std::to_string(chunkSize) + " is too large");
+    if (count > (available - 8) / 8)
+        throw std::runtime_error("truncated RDL binary stream: incomplete chunk table");
+    uint64_t size = 8 + 8 * count;
+    for (uint64_t i = 0; i < count; ++i) {
+        const uint64_t chunk = frame_detail::getLE(bytes + 8 + 8 * i, 8);
+        if (chunk > available - size)
+            throw std::runtime_error("truncated RDL binary stream: compressed chunk " +
+                                     std::to_string(i) + " is incomplete");
+        size += chunk;
+    }
+    // `size` is bounded by `available`, so this cannot overflow.
+    const uint64_t compressed = size - (8 + 8 * count);
+    if (header.manifestSize + header.payloadSize > kMaxDecompressRatio * compressed)
+        throw std::runtime_error("corrupt RDL binary stream: frame sizes exceed what its "
+                                 "compressed chunks can hold");
+    return size;
+}
+
+struct FrameEntry
+{
+    uint64_t offset = 0;  // of the frame header
+    uint64_t size = 0;    // stored size, header included
+    FrameHeader header;
+};
+
+// Locates the frames stored back to back in [data, data + size), reading only
+// their headers.  Throws std::runtime_error if the data ends mid-frame.
+inline std::vector<FrameEntry> scanFrames(const char* data, uint64_t size)
+{
+    std::vector<FrameEntry> frames;
+    uint64_t offset = 0;
+    while (offset < size) {
+        if (size - offset < kFrameHeaderSize)
+            throw std::runtime_error("truncated RDL binary stream: incomplete frame header");
+        FrameEntry entry;
+        entry.offset = offset;
+        entry.header = decodeFrameHeader(data + offset);
+        const uint64_t available = size - offset - kFrameHeaderSize;
+        if (entry.header.compressed()) {
+            entry.size = kFrameHeaderSize +
+                compressedBodySize(entry.header, data + offset + kFrameHeaderSize, available);
+        } else {
+            if (entry.header.manifestSize > available ||
+                entry.header.payloadSize > available - entry.header.manifestSize)
+                throw std::runtime_error("truncated RDL binary stream: frame " +
+                                         std::to_string(frames.size()) + " is incomplete");
+            entry.size = entry.header.frameSize();
+        }
+        offset += entry.size;
+        frames.push_back(entry);
+    }
+    return frames;
+}
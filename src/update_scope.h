@@ -0,0 +1,196 @@
+// Copyright (c) 2026 Alan Blevins
+// SPDX-License-Identifier: MIT
+//
+// Update scopes and change-tracking hooks shared by the setter bindings.
+// Included by the bind_*.cpp files that modify SceneObjects.
+
+#pragma once
+
+#include "bindings.h"
+#include "profiling.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+// ---------------------------------------------------------------------------
+// Change tracking hooks — implemented in bind_change_tracker.cpp.  Setter
+// bindings report each modified object (and attribute, where known) here;
+// the calls cost one relaxed atomic load while no ChangeTracker is recording.
+// Safe to call without the GIL.
+// ---------------------------------------------------------------------------
+extern std::atomic<int> gRecordingChangeTrackers;
+
+void recordChangeToTrackers(const rdl2::SceneObject* obj, const rdl2::Attribute* attr);
+
+inline void recordChange(const rdl2::SceneObject* obj, const rdl2::Attribute* attr = nullptr)
+{
+    if (gRecordingChangeTrackers.load(std::memory_order_relaxed) != 0)
+        recordChangeToTrackers(obj, attr);
+}
+
+// ---------------------------------------------------------------------------
+// UpdateScope — the begin/endUpdate guard used by every setter binding.
+//
+// Behaves like rdl2::SceneObject::UpdateGuard, except that it does nothing
+// when the object is already held open by an UpdateBlock (Python's
+// `with obj.update():` / `with ctx.batchUpdate(objs):`) on the calling
+// thread, so a block of N writes costs one update cycle instead of N.
+// The object is reported to change trackers when the scope closes, unless
+// an exception thrown inside the scope is unwinding it.
+// ---------------------------------------------------------------------------
+
+// The objects held open by active UpdateBlocks, keyed by the thread that
+// entered each block.  Kept behind a mutex rather than in thread-local
+// storage because a block may be finalised on any thread (wherever its last
+// Python reference drops), and its entries must be released all the same.
+// While no block is active, contains() costs one atomic load.
+class HeldUpdates
+{
+public:
+    // Whether the calling thread holds obj open.
+    static bool contains(const rdl2::SceneObject* obj)
+    {
+        if (size().load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex());
+        const auto it = threads().find(std::this_thread::get_id());
+        return it != threads().end() && it->second.count(obj) != 0;
+    }
+
+    // Returns false if thread already holds obj.
+    static bool insert(std::thread::id thread, const rdl2::SceneObject* obj)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        if (!threads()[thread].insert(obj).second)
+            return false;
+        size().fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    static void erase(std::thread::id thread, const rdl2::SceneObject* obj)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        const auto it = threads().find(thread);
+        if (it == threads().end() || it->second.erase(obj) == 0)
+            return;
+        if (it->second.empty())
+            threads().erase(it);
+        size().fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    using Map = std::unordered_map<std::thread::id,
+                                   std::unordered_set<const rdl2::SceneObject*>>;
+
+    static std::mutex& mutex()             { static std::mutex sMutex; return sMutex; }
+    static Map& threads()                  { static Map sThreads; return sThreads; }
+    static std::atomic<size_t>& size()     { static std::atomic<size_t> sSize{0}; return sSize; }
+};
+
+class UpdateScope
+{
+public:
+    explicit UpdateScope(rdl2::SceneObject* obj)
+        : mProfile(Probe::UpdateScope), mObject(HeldUpdates::contains(obj) ? nullptr : obj),
+          mChanged(obj), mUnwinding(std::uncaught_exception())
+    {
+        if (mObject)
+            mObject->beginUpdate();
+    }
+    ~UpdateScope()
+    {
+        if (mObject)
+            mObject->endUpdate();
+        // C++14 has no uncaught_exceptions(), so a scope opened while already
+        // unwinding always records.
+        if (mUnwinding || !std::uncaught_exception())
+            recordChange(mChanged);
+    }
+    UpdateScope(const UpdateScope&) = delete;
+    UpdateScope& operator=(const UpdateScope&) = delete;
+
+private:
+    ProfileScope mProfile;  // declared first: its time includes endUpdate()
+    rdl2::SceneObject* mObject;
+    const rdl2::SceneObject* mChanged;
+    bool mUnwinding;
+};
+
+// UpdateBlock — Python context manager holding a set of objects open for the
+// duration of a `with` block.  Objects already held by an enclosing block are
+// left to that block, so blocks nest.  A block belongs to the thread that
+// entered it; one dropped while still active is closed by its destructor,
+// whichever thread that runs on.
+class UpdateBlock
+{
+public:
+    explicit UpdateBlock(std::vector<rdl2::SceneObject*> objects)
+        : mObjects(std::move(objects)) {}
+
+    ~UpdateBlock()
+    {
+        if (mActive)
+            close();
+    }
+
+    UpdateBlock(UpdateBlock&& other) noexcept
+        : mObjects(std::move(other.mObjects)),
+          mOpened(std::move(other.mOpened)),
+          mThread(other.mThread),
+          mActive(other.mActive)
+    {
+        other.mOpened.clear();
+        other.mActive = false;
+    }
+    UpdateBlock& operator=(UpdateBlock&&) = delete;
+    UpdateBlock(const UpdateBlock&) = delete;
+    UpdateBlock& operator=(const UpdateBlock&) = delete;
+
+    void enter()
+    {
+        if (mActive)
+            throw std::runtime_error("update block is already active");
+        const std::thread::id thread = std::this_thread::get_id();
+        for (rdl2::SceneObject* obj : mObjects) {
+            if (obj && HeldUpdates::insert(thread, obj)) {
+                obj->beginUpdate();
+                mOpened.push_back(obj);
+            }
+        }
+        mThread = thread;
+        mActive = true;
+    }
+
+    void exit()
+    {
+        if (mActive && mThread != std::this_thread::get_id())
+            throw std::runtime_error("update block must be exited on the thread that entered it");
+        close();
+    }
+
+    const std::vector<rdl2::SceneObject*>& getObjects() const { return mObjects; }
+    bool isActive() const { return mActive; }
+
+private:
+    // Ends the updates this block opened and releases them from the entering
+    // thread's held set.  Off that thread this only runs from the destructor,
+    // which Python calls with the GIL held.
+    void close()
+    {
+        for (auto it = mOpened.rbegin(); it != mOpened.rend(); ++it) {
+            HeldUpdates::erase(mThread, *it);
+            (*it)->endUpdate();
+        }
+        mOpened.clear();
+        mActive = false;
+    }
+
+    std::vector<rdl2::SceneObject*> mObjects;
+    std::vector<rdl2::SceneObject*> mOpened;
+    std::thread::id mThread;
+    bool mActive = false;
+};
@@ -18,6 +18,11 @@ if os.path.isdir(_BUILD):
 
 import scene_rdl2 as rdl2
 
+try:
+    import numpy as np
+except ImportError:  # NumPy is only needed by the array-interop tests
+    np = None
+
 DSO_PATH = os.environ.get('RDL2_DSO_PATH')
 if not DSO_PATH:
     sys.exit("Error: RDL2_DSO_PATH is not set. Source MoonRay's setup.sh before running.")
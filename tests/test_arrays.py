@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for NumPy interop: SceneObject.getArray/setArray."""
+
+import unittest
+
+from .helpers import rdl2, np, _WithDsos
+
+
+@unittest.skipIf(np is None, "NumPy is not installed")
+class TestSceneObjectArrays(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.mesh = cls.ctx.createSceneObject("RdlMeshGeometry", "/test/arrays/mesh")
+
+    def test_set_get_vec3f_vector(self):
+        pts = np.arange(12, dtype=np.float32).reshape(4, 3)
+        self.mesh.setArray("vertex_list_0", pts)
+        result = self.mesh.getArray("vertex_list_0")
+        self.assertEqual(result.shape, (4, 3))
+        self.assertEqual(result.dtype, np.float32)
+        np.testing.assert_array_equal(result, pts)
+
+    def test_view_is_read_only(self):
+        self.mesh.setArray("vertex_list_0", np.zeros((2, 3), dtype=np.float32))
+        view = self.mesh.getArray("vertex_list_0", copy=False)
+        self.assertFalse(view.flags.writeable)
+        with self.assertRaises(ValueError):
+            view[0, 0] = 1.0
+
+    def test_copy_is_writable_and_independent(self):
+        self.mesh.setArray("vertex_list_0", np.ones((2, 3), dtype=np.float32))
+        arr = self.mesh.getArray("vertex_list_0")
+        arr[0, 0] = 5.0
+        self.assertEqual(self.mesh["vertex_list_0"][0].x, 1.0)
+
+    def test_default_survives_later_set(self):
+        self.mesh.setArray("vertex_list_0", np.ones((2, 3), dtype=np.float32))
+        arr = self.mesh.getArray("vertex_list_0")
+        self.mesh.setArray("vertex_list_0", np.zeros((1000, 3), dtype=np.float32))
+        np.testing.assert_array_equal(arr, np.ones((2, 3)))
+
+    def test_set_from_math_array(self):
+        pts = rdl2.Vec3fArray.from_numpy(np.arange(6, dtype=np.float32).reshape(2, 3))
+        self.mesh.setArray("vertex_list_0", pts)
+        np.testing.assert_array_equal(self.mesh.getArray("vertex_list_0"), pts.to_numpy())
+
+    def test_int_vector(self):
+        self.mesh.setArray("vertices_by_index", np.array([0, 1, 2, 3], dtype=np.int32))
+        np.testing.assert_array_equal(self.mesh.getArray("vertices_by_index"), [0, 1, 2, 3])
+        self.assertEqual(self.mesh["vertices_by_index"], [0, 1, 2, 3])
+
+    def test_setitem_accepts_ndarray(self):
+        pts = np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float64)  # cast to float32
+        self.mesh["vertex_list_0"] = pts
+        np.testing.assert_array_equal(self.mesh.getArray("vertex_list_0"), pts)
+
+    def test_empty_array(self):
+        self.mesh.setArray("vertex_list_0", np.zeros((0, 3), dtype=np.float32))
+        self.assertEqual(self.mesh.getArray("vertex_list_0").shape, (0, 3))
+
+    def test_wrong_shape_raises(self):
+        with self.assertRaises(ValueError):
+            self.mesh.setArray("vertex_list_0", np.zeros((4, 2), dtype=np.float32))
+
+    def test_unsupported_type_raises(self):
+        with self.assertRaises(TypeError):
+            self.mesh.getArray("is_subd")
+
+
+if __name__ == "__main__":
+    unittest.main()
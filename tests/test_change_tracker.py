@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for ChangeTracker: recording edits and emitting delta updates."""
+
+import io
+import unittest
+
+from .helpers import rdl2, _make_ctx, _WithDsos
+
+
+class TestChangeTracker(_WithDsos):
+    def setUp(self):
+        self.sv = self.ctx.getSceneVariables()
+        self.geo_set = self.ctx.createSceneObject(
+            "GeometrySet", "/test/tracker/" + self._testMethodName + "/gs")
+        self.ctx.commitAllChanges()
+        self.tracker = rdl2.ChangeTracker(self.ctx)
+
+    def tearDown(self):
+        self.tracker.stop()
+
+    def test_starts_empty(self):
+        self.assertTrue(self.tracker.isRecording())
+        self.assertFalse(self.tracker.hasChanges())
+        self.assertEqual(len(self.tracker), 0)
+
+    def test_records_attribute_sets(self):
+        self.sv["image_width"] = 800
+        self.sv["image_height"] = 600
+        self.sv["image_width"] = 801
+        self.assertEqual([o.getName() for o in self.tracker.getChangedObjects()],
+                         [self.sv.getName()])
+        self.assertEqual(self.tracker.getChangedAttributes(self.sv),
+                         ["image_width", "image_height"])
+
+    def test_records_object_level_edits(self):
+        self.geo_set.asGeometrySet().clear()
+        self.assertEqual(len(self.tracker), 1)
+        self.assertEqual(self.tracker.getChangedAttributes(self.geo_set), [])
+
+    def test_ignores_failed_writes(self):
+        with self.assertRaises(Exception):
+            self.geo_set.setBinding("no_such_attribute", self.sv)
+        self.assertFalse(self.tracker.hasChanges())
+
+    def test_ignores_other_contexts(self):
+        other = _make_ctx()
+        other.getSceneVariables()["image_width"] = 10
+        self.assertFalse(self.tracker.hasChanges())
+
+    def test_stop_and_clear(self):
+        self.sv["frame"] = 2.0
+        self.tracker.clear()
+        self.assertFalse(self.tracker.hasChanges())
+        self.tracker.stop()
+        self.sv["frame"] = 3.0
+        self.assertFalse(self.tracker.hasChanges())
+
+    def test_delta_round_trip(self):
+        base = _make_ctx(load_dsos=True)
+        rdl2.BinaryReader(base).fromBytes(*rdl2.BinaryWriter(self.ctx).toBytes())
+
+        self.sv["image_width"] = 1234
+        manifest, payload = self.tracker.toBytes(commit=True)
+        self.assertFalse(self.tracker.hasChanges())
+        self.assertFalse(self.sv.isDirty())
+
+        rdl2.BinaryReader(base).fromBytes(manifest, payload)
+        self.assertEqual(base.getSceneVariables()["image_width"], 1234)
+
+    def test_delta_to_stream(self):
+        self.sv["image_height"] = 321
+        buf = io.BytesIO()
+        self.tracker.toStream(buf)
+        buf.seek(0)
+        read_ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(read_ctx).fromStream(buf), 1)
+        self.assertEqual(read_ctx.getSceneVariables()["image_height"], 321)
+
+
+if __name__ == "__main__":
+    unittest.main()
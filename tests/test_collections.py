@@ -5,7 +5,7 @@
 
 import unittest
 
-from .helpers import rdl2, _WithDsos, _first_class_name
+from .helpers import rdl2, np, _WithDsos, _first_class_name
 
 
 class TestGeometrySet(_WithDsos):
@@ -142,6 +142,33 @@ class TestLayer(_WithDsos):
     def test_light_sets_changed_is_bool(self):
         self.assertIsInstance(self.layer.lightSetsChanged(), bool)
 
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_assign_many_returns_int32_ids(self):
+        layer = self.ctx.createSceneObject("Layer", "/test/layer/many").asLayer()
+        ids = layer.assignMany(self.geo, ["a", "b", "c"],
+                               materials=self.mat, light_sets=[self.lset] * 3)
+        self.assertEqual(ids.dtype, np.int32)
+        self.assertEqual(len(set(ids.tolist())), 3)
+        self.assertEqual(layer.lookupMaterial(int(ids[1])).getName(), self.mat.getName())
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_assign_many_column_length_mismatch_raises(self):
+        layer = self.ctx.createSceneObject("Layer", "/test/layer/many_bad").asLayer()
+        with self.assertRaises(ValueError):
+            layer.assignMany(self.geo, ["a", "b"], materials=[self.mat])
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_export_assignments_round_trip(self):
+        layer = self.ctx.createSceneObject("Layer", "/test/layer/export").asLayer()
+        ids = layer.assignMany(self.geo, ["a", "b"], materials=self.mat, light_sets=self.lset)
+        table = layer.exportAssignments()
+        np.testing.assert_array_equal(table["assignment_ids"], ids)
+        self.assertEqual(table["part_names"], ["a", "b"])
+        self.assertIsNone(table["displacements"][0])
+        copy = self.ctx.createSceneObject("Layer", "/test/layer/export_copy").asLayer()
+        copy.assignMany(**table)
+        self.assertEqual(copy.exportAssignments()["part_names"], ["a", "b"])
+
 
 class TestRenderOutput(_WithDsos):
     @classmethod
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for diff(): comparing two SceneContexts."""
+
+import unittest
+
+from .helpers import rdl2, _make_ctx, _first_class_name, _WithDsos
+
+
+def _scene(light_class):
+    # diff() compares whole contexts, so each test needs a fresh pair.  Load
+    # only the classes the tests create rather than every DSO.
+    ctx = _make_ctx()
+    for class_name in (light_class, "GeometrySet", "LightSet"):
+        ctx.createSceneClass(class_name)
+    light = ctx.createSceneObject(light_class, "/diff/light")
+    light["intensity"] = 2.0
+    ctx.createSceneObject("GeometrySet", "/diff/gset")
+    return ctx, light
+
+
+class TestDiff(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.light_class = _first_class_name(cls.ctx, rdl2.INTERFACE_LIGHT)
+
+    def setUp(self):
+        self.a, self.light_a = _scene(self.light_class)
+        self.b, self.light_b = _scene(self.light_class)
+
+    def test_identical_scenes(self):
+        d = rdl2.diff(self.a, self.b)
+        self.assertIsInstance(d, rdl2.SceneDiff)
+        self.assertTrue(d.isEmpty())
+        self.assertFalse(d)
+        self.assertEqual((d.added, d.removed, d.changed), ([], [], {}))
+
+    def test_changed_attribute(self):
+        self.light_b["intensity"] = 3.0
+        d = rdl2.diff(self.a, self.b)
+        self.assertEqual(d.changed, {"/diff/light": ["intensity"]})
+
+    def test_tolerance(self):
+        self.light_b["intensity"] = 2.0 + 1e-4
+        self.assertTrue(rdl2.diff(self.a, self.b))
+        self.assertFalse(rdl2.diff(self.a, self.b, atol=1e-3))
+        self.assertFalse(rdl2.diff(self.a, self.b, rtol=1e-3))
+
+    def test_ignore(self):
+        self.light_b["intensity"] = 3.0
+        self.assertFalse(rdl2.diff(self.a, self.b, ignore=["intensity"]))
+
+    def test_added_and_removed(self):
+        self.a.createSceneObject("GeometrySet", "/diff/only_a")
+        self.b.createSceneObject("GeometrySet", "/diff/only_b")
+        d = rdl2.diff(self.a, self.b)
+        self.assertEqual(d.removed, ["/diff/only_a"])
+        self.assertEqual(d.added, ["/diff/only_b"])
+
+    def test_class_change_is_remove_and_add(self):
+        self.a.createSceneObject("GeometrySet", "/diff/retyped")
+        self.b.createSceneObject("LightSet", "/diff/retyped")
+        d = rdl2.diff(self.a, self.b)
+        self.assertIn("/diff/retyped", d.removed)
+        self.assertIn("/diff/retyped", d.added)
+
+    def test_negative_tolerance_raises(self):
+        with self.assertRaises(ValueError):
+            rdl2.diff(self.ctx, self.ctx, rtol=-1.0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for SceneContext.dependencyGraph() and DependencyGraph."""
+
+import unittest
+
+from .helpers import rdl2, _make_ctx, _first_class_name, _WithDsos
+
+
+class TestDependencyGraph(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.light_class = _first_class_name(cls.ctx, rdl2.INTERFACE_LIGHT)
+
+    def setUp(self):
+        prefix = "/test/graph/" + self._testMethodName
+        self.light = self.ctx.createSceneObject(self.light_class, prefix + "/light")
+        self.spare = self.ctx.createSceneObject(self.light_class, prefix + "/spare")
+        self.lset = self.ctx.createSceneObject("LightSet", prefix + "/lset")
+        self.lset.add(self.light)
+        self.graph = self.ctx.dependencyGraph()
+
+    def test_nodes_are_every_object(self):
+        self.assertEqual(len(self.graph), len(self.ctx.getAllSceneObjects()))
+        i = self.graph.indexOf(self.lset)
+        self.assertEqual(self.graph.objects()[i].getName(), self.lset.getName())
+
+    def test_set_membership_is_an_edge(self):
+        self.assertEqual([o.getName() for o in self.graph.dependencies(self.lset)],
+                         [self.light.getName()])
+        self.assertEqual([o.getName() for o in self.graph.dependents(self.light)],
+                         [self.lset.getName()])
+
+    def test_csr_arrays(self):
+        offsets, targets = self.graph.offsets(), self.graph.targets()
+        self.assertEqual(len(offsets), len(self.graph) + 1)
+        self.assertEqual(offsets[-1], len(targets))
+        self.assertEqual(self.graph.edgeCount(), len(targets))
+        i = self.graph.indexOf(self.lset)
+        self.assertIn(self.graph.indexOf(self.light), list(targets[offsets[i]:offsets[i + 1]]))
+        self.assertEqual(len(self.graph.targets(reverse=True)), len(targets))
+
+    def test_closures(self):
+        names = lambda objs: {o.getName() for o in objs}
+        self.assertEqual(names(self.graph.closure([self.lset])), names([self.lset, self.light]))
+        self.assertIn(self.lset.getName(), names(self.graph.reverseClosure([self.light])))
+        self.assertNotIn(self.lset.getName(), names(self.graph.reverseClosure([self.spare])))
+
+    def test_topological_order_puts_dependencies_first(self):
+        order = [o.getName() for o in self.graph.topologicalOrder()]
+        self.assertEqual(len(order), len(self.graph))
+        self.assertLess(order.index(self.light.getName()), order.index(self.lset.getName()))
+
+    def test_graph_is_a_snapshot(self):
+        self.lset.add(self.spare)
+        self.assertEqual(len(self.graph.dependencies(self.lset)), 1)
+        self.assertEqual(len(self.ctx.dependencyGraph().dependencies(self.lset)), 2)
+
+    def test_unknown_object_raises(self):
+        other = _make_ctx(load_dsos=True)
+        stranger = other.createSceneObject("LightSet", "/graph/stranger")
+        with self.assertRaises(KeyError):
+            self.graph.closure([stranger])
+
+
+if __name__ == "__main__":
+    unittest.main()
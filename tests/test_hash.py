@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for SceneObject.contentHash() and SceneContext.hashAll()."""
+
+import unittest
+
+from .helpers import rdl2, _WithDsos, _first_class_name
+
+
+class TestContentHash(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.light_class = _first_class_name(cls.ctx, rdl2.INTERFACE_LIGHT)
+
+    def setUp(self):
+        prefix = "/test/hash/" + self._testMethodName
+        self.a = self.ctx.createSceneObject(self.light_class, prefix + "/a")
+        self.b = self.ctx.createSceneObject(self.light_class, prefix + "/b")
+        self.lset = self.ctx.createSceneObject("LightSet", prefix + "/lset")
+        self.lset.add(self.a)
+
+    def test_format_and_stability(self):
+        h = self.a.contentHash()
+        self.assertEqual(len(h), 32)
+        int(h, 16)
+        self.assertEqual(h, self.a.contentHash())
+
+    def test_name_is_not_hashed(self):
+        self.assertEqual(self.a.contentHash(), self.b.contentHash())
+
+    def test_value_change_changes_hash(self):
+        before = self.a.contentHash()
+        self.a["intensity"] = self.a["intensity"] + 1.0
+        self.assertNotEqual(before, self.a.contentHash())
+
+    def test_references_hash_by_name(self):
+        before = self.lset.contentHash()
+        self.a["intensity"] = self.a["intensity"] + 1.0
+        self.assertEqual(before, self.lset.contentHash())
+
+    def test_recursive_sees_referenced_changes(self):
+        before = self.lset.contentHash(recursive=True)
+        self.a["intensity"] = self.a["intensity"] + 1.0
+        self.assertNotEqual(before, self.lset.contentHash(recursive=True))
+
+    def test_hash_all_matches_content_hash(self):
+        for recursive in (False, True):
+            hashes = self.ctx.hashAll(recursive=recursive)
+            self.assertEqual(len(hashes), len(self.ctx.getAllSceneObjects()))
+            for obj in (self.a, self.lset):
+                self.assertEqual(hashes[obj.getName()], obj.contentHash(recursive=recursive))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -3,11 +3,14 @@
 # SPDX-License-Identifier: MIT
 """Tests for I/O: BinaryWriter/Reader, AsciiWriter/Reader, and file persistence."""
 
+import io
 import os
+import struct
 import tempfile
+import threading
 import unittest
 
-from .helpers import rdl2, _make_ctx, _FIXTURE_DIR
+from .helpers import rdl2, _make_ctx, _first_class_name, _FIXTURE_DIR
 
 
 class TestBinaryWriter(unittest.TestCase):
@@ -57,6 +60,60 @@ class TestBinaryWriter(unittest.TestCase):
         finally:
             os.unlink(tmp_path)
 
+    def test_to_bytes_without_copy_returns_memoryviews(self):
+        self.ctx.getSceneVariables()["image_width"] = 321
+        manifest, payload = rdl2.BinaryWriter(self.ctx).toBytes(copy=False)
+        self.assertIsInstance(manifest, memoryview)
+        self.assertIsInstance(payload, memoryview)
+        self.assertTrue(payload.readonly)
+        read_ctx = _make_ctx()
+        rdl2.BinaryReader(read_ctx).fromBytes(manifest, payload)
+        self.assertEqual(read_ctx.getSceneVariables()["image_width"], 321)
+
+    def test_to_stream_round_trip(self):
+        self.ctx.getSceneVariables()["image_width"] = 322
+        buf = io.BytesIO()
+        written = rdl2.BinaryWriter(self.ctx).toStream(buf)
+        self.assertEqual(written, len(buf.getvalue()))
+        buf.seek(0)
+        read_ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(read_ctx).fromStream(buf), 1)
+        self.assertEqual(read_ctx.getSceneVariables()["image_width"], 322)
+
+    def test_to_stream_writer_may_keep_views(self):
+        self.ctx.getSceneVariables()["image_width"] = 324
+
+        class Keeper:
+            def __init__(self):
+                self.views = []
+
+            def write(self, view):
+                self.views.append(view)
+                return len(view)
+
+        keeper = Keeper()
+        rdl2.BinaryWriter(self.ctx).toStream(keeper)
+        data = b"".join(bytes(v) for v in keeper.views)
+        read_ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(read_ctx).fromStream(data), 1)
+        self.assertEqual(read_ctx.getSceneVariables()["image_width"], 324)
+
+    def test_to_file_descriptor_round_trip(self):
+        self.ctx.getSceneVariables()["image_width"] = 323
+        fd, tmp_path = tempfile.mkstemp(suffix=".rdls")
+        try:
+            writer = rdl2.BinaryWriter(self.ctx)
+            written = writer.toFileDescriptor(fd)
+            writer.toFileDescriptor(fd)  # frames append
+            os.close(fd)
+            self.assertEqual(os.path.getsize(tmp_path), 2 * written)
+            read_ctx = _make_ctx()
+            with open(tmp_path, "rb") as f:
+                self.assertEqual(rdl2.BinaryReader(read_ctx).fromStream(f), 2)
+            self.assertEqual(read_ctx.getSceneVariables()["image_width"], 323)
+        finally:
+            os.unlink(tmp_path)
+
     def test_show_returns_str(self):
         s = rdl2.BinaryWriter(self.ctx).show("", False)
         self.assertIsInstance(s, str)
@@ -121,6 +178,309 @@ class TestBinaryRoundTrip(unittest.TestCase):
         self.assertEqual(read_ctx.getSceneVariables()["image_height"], 720)
 
 
+def _frame(manifest, payload):
+    """Encode one framed-stream frame (see src/stream_format.h)."""
+    return struct.pack("<4sIQQ", b"RDLS", 0, len(manifest), len(payload)) + manifest + payload
+
+
+class TestBinaryStream(unittest.TestCase):
+    def setUp(self):
+        self.src = _make_ctx()
+        self.src.getSceneVariables()["image_width"] = 640
+        self.full = _frame(*rdl2.BinaryWriter(self.src).toBytes())
+        self.src.commitAllChanges()
+        self.src.getSceneVariables()["image_height"] = 480
+        writer = rdl2.BinaryWriter(self.src)
+        writer.setDeltaEncoding(True)
+        self.delta = _frame(*writer.toBytes())
+
+    def test_from_file_like(self):
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStream(io.BytesIO(self.full)), 1)
+        self.assertEqual(ctx.getSceneVariables()["image_width"], 640)
+
+    def test_from_bytes_object(self):
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStream(self.full + self.delta), 2)
+        self.assertEqual(ctx.getSceneVariables()["image_height"], 480)
+
+    def test_from_chunk_generator(self):
+        data = self.full + self.delta
+        chunks = (data[i:i + 7] for i in range(0, len(data), 7))
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStream(chunks), 2)
+        sv = ctx.getSceneVariables()
+        self.assertEqual(sv["image_width"], 640)
+        self.assertEqual(sv["image_height"], 480)
+
+    def test_chunks_may_be_memoryviews(self):
+        data = memoryview(bytearray(self.full))
+        ctx = _make_ctx()
+        rdl2.BinaryReader(ctx).fromStream([data[:10], data[10:]])
+        self.assertEqual(ctx.getSceneVariables()["image_width"], 640)
+
+    def test_empty_stream(self):
+        self.assertEqual(rdl2.BinaryReader(_make_ctx()).fromStream(io.BytesIO()), 0)
+
+    def test_truncated_stream_raises(self):
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader(_make_ctx()).fromStream(io.BytesIO(self.full[:-1]))
+
+    def test_bad_magic_raises(self):
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader(_make_ctx()).fromStream(b"XXXX" + self.full[4:])
+
+    def test_oversized_header_raises_truncated(self):
+        # Sizes are read from the stream, not allocated up front.
+        header = struct.pack("<4sIQQ", b"RDLS", 0, 1 << 40, 1 << 40)
+        with self.assertRaisesRegex(RuntimeError, "truncated"):
+            rdl2.BinaryReader(_make_ctx()).fromStream(header + b"\0" * 64)
+
+
+class TestStreamFile(unittest.TestCase):
+    def setUp(self):
+        TestBinaryStream.setUp(self)  # self.full, self.delta
+        fd, self.path = tempfile.mkstemp(suffix=".rdls")
+        with os.fdopen(fd, "wb") as f:
+            f.write(self.full + self.delta)
+
+    def tearDown(self):
+        os.unlink(self.path)
+
+    def test_frame_index(self):
+        index = rdl2.BinaryReader.frameIndex(self.path)
+        self.assertEqual(len(index), 2)
+        self.assertEqual(index[0][0], 0)
+        self.assertEqual(index[1][0], len(self.full))
+        self.assertEqual(24 + index[0][1] + index[0][2], len(self.full))
+
+    def test_all_frames(self):
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStreamFile(self.path), 2)
+        sv = ctx.getSceneVariables()
+        self.assertEqual(sv["image_width"], 640)
+        self.assertEqual(sv["image_height"], 480)
+
+    def test_selected_frames(self):
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStreamFile(self.path, frames=[0]), 1)
+        sv = ctx.getSceneVariables()
+        self.assertEqual(sv["image_width"], 640)
+        self.assertNotEqual(sv["image_height"], 480)
+
+    def test_frame_out_of_range_raises(self):
+        with self.assertRaises(IndexError):
+            rdl2.BinaryReader(_make_ctx()).fromStreamFile(self.path, frames=[2])
+
+    def test_truncated_file_raises(self):
+        with open(self.path, "r+b") as f:
+            f.truncate(len(self.full) + 10)
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader(_make_ctx()).fromStreamFile(self.path)
+
+
+class TestCompressedStream(unittest.TestCase):
+    def setUp(self):
+        self.src = _make_ctx()
+        sv = self.src.getSceneVariables()
+        sv["image_width"] = 640
+        sv["image_height"] = 480
+        self.plain = io.BytesIO()
+        rdl2.BinaryWriter(self.src).toStream(self.plain)
+
+    def _compressed(self, **kwargs):
+        out = io.BytesIO()
+        written = rdl2.BinaryWriter(self.src).toStream(out, compression=6, **kwargs)
+        self.assertEqual(written, len(out.getvalue()))
+        return out.getvalue()
+
+    def test_flag_set_and_smaller(self):
+        data = self._compressed()
+        flags, = struct.unpack_from("<I", data, 4)
+        self.assertEqual(flags, 1)
+        self.assertLess(len(data), len(self.plain.getvalue()))
+
+    def test_from_stream_round_trip(self):
+        # Small chunks: several chunks, one straddling manifest and payload.
+        data = self._compressed(chunk_size=64)
+        ctx = _make_ctx()
+        self.assertEqual(rdl2.BinaryReader(ctx).fromStream(io.BytesIO(data)), 1)
+        sv = ctx.getSceneVariables()
+        self.assertEqual(sv["image_width"], 640)
+        self.assertEqual(sv["image_height"], 480)
+
+    def test_mixed_frames_from_stream_file(self):
+        fd, path = tempfile.mkstemp(suffix=".rdls")
+        try:
+            with os.fdopen(fd, "wb") as f:
+                rdl2.BinaryWriter(self.src).toFileDescriptor(f.fileno(), compression=1)
+                f.write(self.plain.getvalue())
+            index = rdl2.BinaryReader.frameIndex(path)
+            self.assertEqual(len(index), 2)
+            ctx = _make_ctx()
+            self.assertEqual(rdl2.BinaryReader(ctx).fromStreamFile(path, frames=[0]), 1)
+            self.assertEqual(ctx.getSceneVariables()["image_width"], 640)
+        finally:
+            os.unlink(path)
+
+    def test_truncated_compressed_stream_raises(self):
+        data = self._compressed(chunk_size=64)
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader(_make_ctx()).fromStream(io.BytesIO(data[:-1]))
+
+    def test_corrupt_chunk_table_raises(self):
+        data = bytearray(self._compressed(chunk_size=64))
+        struct.pack_into("<Q", data, 8, 1 << 62)  # manifest size
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader(_make_ctx()).fromStream(io.BytesIO(bytes(data)))
+
+    def test_sizes_beyond_chunk_bytes_raise(self):
+        # One 1 GiB chunk of a few compressed bytes: rejected before allocating.
+        data = bytearray(self._compressed(chunk_size=64))
+        struct.pack_into("<QQQ", data, 8, 1 << 30, 0, 1 << 30)
+        with self.assertRaisesRegex(RuntimeError, "exceed"):
+            rdl2.BinaryReader(_make_ctx()).fromStream(io.BytesIO(bytes(data)))
+
+    def test_bad_level_raises(self):
+        with self.assertRaises(ValueError):
+            rdl2.BinaryWriter(self.src).toStream(io.BytesIO(), compression=20)
+
+
+class TestIndexedArchive(unittest.TestCase):
+    def setUp(self):
+        src = _make_ctx(load_dsos=True)
+        light_class = _first_class_name(src, rdl2.INTERFACE_LIGHT)
+        self.light = src.createSceneObject(light_class, "/arc/light")
+        self.light["intensity"] = 7.0
+        lset = src.createSceneObject("LightSet", "/arc/lset")
+        lset.add(self.light)
+        data = src.createSceneObject("UserData", "/arc/data")
+        data.setFloatData("weights", [0.5, 1.5, 2.5])
+        self.src = src
+        fd, self.path = tempfile.mkstemp(suffix=".rdli")
+        os.close(fd)
+        rdl2.BinaryWriter(src).writeIndexedFile(self.path)
+
+    def tearDown(self):
+        os.unlink(self.path)
+
+    def test_index_lists_every_object(self):
+        index = rdl2.BinaryReader.readIndex(self.path)
+        self.assertEqual(sorted(e.name for e in index),
+                         sorted(o.getName() for o in self.src.getAllSceneObjects()))
+        entry = next(e for e in index if e.name == "/arc/lset")
+        self.assertEqual(entry.className, "LightSet")
+        self.assertGreater(entry.length, 0)
+
+    def test_read_single_object(self):
+        ctx = _make_ctx(load_dsos=True)
+        self.assertEqual(rdl2.BinaryReader(ctx).readObjects(self.path, ["/arc/data"]), 1)
+        self.assertEqual(list(ctx.getSceneObject("/arc/data").getFloatValues()),
+                         [0.5, 1.5, 2.5])
+        self.assertFalse(ctx.sceneObjectExists("/arc/lset"))
+
+    def test_references_are_created_with_defaults(self):
+        ctx = _make_ctx(load_dsos=True)
+        rdl2.BinaryReader(ctx).readObjects(self.path, ["/arc/lset"])
+        self.assertTrue(ctx.getSceneObject("/arc/lset").contains(
+            ctx.getSceneObject("/arc/light")))
+        self.assertNotEqual(ctx.getSceneObject("/arc/light")["intensity"], 7.0)
+
+    def test_references_decoded_on_request(self):
+        ctx = _make_ctx(load_dsos=True)
+        count = rdl2.BinaryReader(ctx).readObjects(self.path, ["/arc/lset"], references=True)
+        self.assertEqual(count, 2)
+        self.assertEqual(ctx.getSceneObject("/arc/light")["intensity"], 7.0)
+
+    def test_reads_are_not_tracked(self):
+        ctx = _make_ctx(load_dsos=True)
+        tracker = rdl2.ChangeTracker(ctx)
+        rdl2.BinaryReader(ctx).readObjects(self.path, ["/arc/lset"], references=True)
+        self.assertFalse(tracker.hasChanges())
+        tracker.stop()
+
+    def test_missing_name_raises(self):
+        with self.assertRaises(KeyError):
+            rdl2.BinaryReader(_make_ctx(load_dsos=True)).readObjects(self.path, ["/nope"])
+
+    def test_not_an_archive_raises(self):
+        with open(self.path, "wb") as f:
+            f.write(b"RDLS" + bytes(40))
+        with self.assertRaises(RuntimeError):
+            rdl2.BinaryReader.readIndex(self.path)
+
+    def test_dedup_shares_identical_vectors(self):
+        weights = [float(i) for i in range(4096)]
+        for i in range(8):
+            self.src.createSceneObject("UserData", "/arc/copy%d" % i).setFloatData("w", weights)
+        fd, dedup = tempfile.mkstemp(suffix=".rdli")
+        os.close(fd)
+        try:
+            rdl2.BinaryWriter(self.src).writeIndexedFile(self.path)
+            rdl2.BinaryWriter(self.src).writeIndexedFile(dedup, dedup_min_bytes=1024)
+            # Seven of the eight 16 KiB copies are not written again.
+            self.assertLess(os.path.getsize(dedup), os.path.getsize(self.path) - 7 * 16384 + 4096)
+            ctx = _make_ctx(load_dsos=True)
+            rdl2.BinaryReader(ctx).readObjects(dedup, ["/arc/copy3", "/arc/data"])
+            self.assertEqual(list(ctx.getSceneObject("/arc/copy3").getFloatValues()), weights)
+            self.assertEqual(list(ctx.getSceneObject("/arc/data").getFloatValues()),
+                             [0.5, 1.5, 2.5])
+        finally:
+            os.unlink(dedup)
+
+
+def _snapshot_worker(name):
+    ctx = rdl2.SceneContext.fromSnapshot(name)
+    return ctx.getSceneVariables()["image_width"]
+
+
+class TestSceneSnapshot(unittest.TestCase):
+    def setUp(self):
+        self.src = _make_ctx()
+        self.src.getSceneVariables()["image_width"] = 1234
+
+    def test_export_returns_linked_snapshot(self):
+        with self.src.exportSnapshot() as snap:
+            self.assertIsInstance(snap, rdl2.SceneSnapshot)
+            self.assertTrue(snap.getName().startswith("/"))
+            self.assertGreater(snap.getSize(), 24)
+            self.assertTrue(snap.isLinked())
+        self.assertFalse(snap.isLinked())
+
+    def test_from_snapshot_builds_new_context(self):
+        with self.src.exportSnapshot() as snap:
+            ctx = rdl2.SceneContext.fromSnapshot(snap.getName())
+        self.assertIsInstance(ctx, rdl2.SceneContext)
+        self.assertEqual(ctx.getSceneVariables()["image_width"], 1234)
+
+    def test_reader_from_snapshot(self):
+        with self.src.exportSnapshot() as snap:
+            ctx = _make_ctx()
+            rdl2.BinaryReader(ctx).fromSnapshot(snap.getName().lstrip("/"))
+        self.assertEqual(ctx.getSceneVariables()["image_width"], 1234)
+
+    def test_explicit_name_and_duplicate(self):
+        name = "rdl2-test-%d" % os.getpid()
+        with self.src.exportSnapshot(name) as snap:
+            self.assertEqual(snap.getName(), "/" + name)
+            with self.assertRaises(RuntimeError):
+                self.src.exportSnapshot(name)
+
+    def test_unlinked_snapshot_cannot_be_opened(self):
+        snap = self.src.exportSnapshot()
+        snap.unlink()
+        snap.unlink()
+        with self.assertRaises(RuntimeError):
+            rdl2.SceneContext.fromSnapshot(snap.getName())
+
+    def test_worker_processes(self):
+        import multiprocessing
+        with self.src.exportSnapshot() as snap:
+            with multiprocessing.get_context("spawn").Pool(2) as pool:
+                widths = pool.map(_snapshot_worker, [snap.getName()] * 2)
+        self.assertEqual(widths, [1234, 1234])
+
+
 class TestRdlaFilePersistence(unittest.TestCase):
     """Writes a populated scene to tests/fixtures/test_scene.rdla, then reads it back."""
 
@@ -413,5 +773,36 @@ class TestAsciiRoundTrip(unittest.TestCase):
         self.assertTrue(read_ctx.sceneObjectExists("/test/rt/ro1"))
 
 
+class TestThreadedIO(unittest.TestCase):
+    """Readers/writers release the GIL; separate contexts may load concurrently."""
+
+    def test_parallel_loads_into_separate_contexts(self):
+        src = _make_ctx()
+        src.getSceneVariables()["image_width"] = 4321
+        manifest, payload = rdl2.BinaryWriter(src).toBytes()
+        rdla = rdl2.AsciiWriter(src).toString()
+
+        ctxs = [_make_ctx() for _ in range(4)]
+        errors = []
+
+        def load(i):
+            try:
+                if i % 2:
+                    rdl2.BinaryReader(ctxs[i]).fromBytes(manifest, payload)
+                else:
+                    rdl2.AsciiReader(ctxs[i]).fromString(rdla)
+            except Exception as e:  # surfaced on the main thread below
+                errors.append(e)
+
+        threads = [threading.Thread(target=load, args=(i,)) for i in range(len(ctxs))]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+        for ctx in ctxs:
+            self.assertEqual(ctx.getSceneVariables()["image_width"], 4321)
+
+
 if __name__ == "__main__":
     unittest.main()
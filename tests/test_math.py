@@ -5,7 +5,7 @@
 
 import unittest
 
-from .helpers import rdl2, _WithDsos, _first_class_name
+from .helpers import rdl2, np, _WithDsos, _first_class_name
 
 
 class TestRgb(unittest.TestCase):
@@ -501,5 +501,90 @@ class TestMathImplicitConversion(_WithDsos):
         self.assertAlmostEqual(result.vw.z, 30.0)
 
 
+@unittest.skipIf(np is None, "NumPy is not installed")
+class TestMathBufferProtocol(unittest.TestCase):
+    def test_vec3f_to_numpy(self):
+        a = np.asarray(rdl2.Vec3f(1, 2, 3))
+        self.assertEqual(a.shape, (3,))
+        self.assertEqual(a.dtype, np.float32)
+        np.testing.assert_array_equal(a, [1, 2, 3])
+
+    def test_mat4d_to_numpy(self):
+        m = rdl2.Mat4d([[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0], [5, 6, 7, 1]])
+        a = np.asarray(m)
+        self.assertEqual(a.shape, (4, 4))
+        self.assertEqual(a.dtype, np.float64)
+        np.testing.assert_array_equal(a[3], [5, 6, 7, 1])
+
+    def test_rgb_from_numpy(self):
+        c = rdl2.Rgb(np.array([0.25, 0.5, 1.0]))
+        self.assertAlmostEqual(c.g, 0.5)
+
+    def test_mat4f_from_numpy(self):
+        m = rdl2.Mat4f(np.eye(4, dtype=np.float32))
+        self.assertEqual(m.vx.x, 1.0)
+        self.assertEqual(m.vx.y, 0.0)
+
+    def test_from_numpy_wrong_shape_raises(self):
+        with self.assertRaises(ValueError):
+            rdl2.Vec3f(np.zeros(4))
+
+    def test_from_numpy_scalars(self):
+        for scalar in (np.float32(0.5), np.int64(2)):
+            value = float(scalar)
+            c = rdl2.Rgb(scalar)
+            self.assertEqual((c.r, c.g, c.b), (value, value, value))
+            v = rdl2.Vec3f(scalar)
+            self.assertEqual((v.x, v.y, v.z), (value, value, value))
+            np.testing.assert_array_equal(np.asarray(rdl2.Mat4d(scalar)),
+                                          np.full((4, 4), value))
+
+    def test_from_array_element(self):
+        arr = np.array([0.25, 0.75], dtype=np.float32)
+        self.assertEqual(rdl2.Vec3f(arr[1]).y, 0.75)
+
+
+@unittest.skipIf(np is None, "NumPy is not installed")
+class TestMathArrays(unittest.TestCase):
+    def test_from_numpy_round_trip(self):
+        src = np.arange(12, dtype=np.float32).reshape(4, 3)
+        arr = rdl2.Vec3fArray.from_numpy(src)
+        self.assertEqual(len(arr), 4)
+        np.testing.assert_array_equal(arr.to_numpy(), src)
+
+    def test_to_numpy_view_shares_memory(self):
+        arr = rdl2.Vec3fArray(np.zeros((2, 3), dtype=np.float32))
+        view = arr.to_numpy()
+        view[1, 2] = 7.0
+        self.assertEqual(arr[1].z, 7.0)
+
+    def test_to_numpy_copy_is_independent(self):
+        arr = rdl2.Vec3fArray(np.zeros((2, 3), dtype=np.float32))
+        copy = arr.to_numpy(copy=True)
+        copy[0, 0] = 1.0
+        self.assertEqual(arr[0].x, 0.0)
+
+    def test_buffer_protocol(self):
+        arr = rdl2.Mat4dArray(np.tile(np.eye(4), (3, 1, 1)))
+        self.assertEqual(np.asarray(arr).shape, (3, 4, 4))
+        self.assertEqual(memoryview(arr).shape, (3, 4, 4))
+
+    def test_getitem_setitem(self):
+        arr = rdl2.RgbArray(np.zeros((2, 3), dtype=np.float32))
+        arr[-1] = rdl2.Rgb(1, 0, 0)
+        self.assertEqual(arr[1].r, 1.0)
+        with self.assertRaises(IndexError):
+            _ = arr[2]
+
+    def test_tolist(self):
+        arr = rdl2.Vec2fArray([[1, 2], [3, 4]])
+        self.assertEqual(arr.tolist()[1], rdl2.Vec2f(3, 4))
+
+    def test_empty(self):
+        arr = rdl2.Vec4dArray()
+        self.assertEqual(len(arr), 0)
+        self.assertEqual(arr.to_numpy().shape, (0, 4))
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for SceneObject.memoryUsage() and SceneContext.memoryReport()."""
+
+import unittest
+
+from .helpers import rdl2, _WithDsos
+
+
+class TestMemoryUsage(_WithDsos):
+    def setUp(self):
+        self.prefix = "/test/memory/" + self._testMethodName
+        self.data = self.ctx.createSceneObject("UserData", self.prefix + "/data")
+
+    def test_grows_with_vector_data(self):
+        before = self.data.memoryUsage()
+        self.assertGreater(before, 0)
+        self.data.setFloatData("f", [0.0] * 100000)
+        self.assertGreaterEqual(self.data.memoryUsage() - before, 100000 * 4)
+
+    def test_by_attribute_sums_to_total(self):
+        self.data.setFloatData("f", [1.0] * 1000)
+        per_attr = self.data.memoryUsage(by_attribute=True)
+        self.assertEqual(sum(per_attr.values()), self.data.memoryUsage())
+        sizes = list(per_attr.values())
+        self.assertEqual(sizes, sorted(sizes, reverse=True))
+
+    def test_report_groupings_agree(self):
+        self.ctx.createSceneObject("GeometrySet", self.prefix + "/gset")
+        self.data.setFloatData("f", [1.0] * 1000)
+        by_object = self.ctx.memoryReport(group_by="object")
+        self.assertEqual(by_object[self.data.getName()], self.data.memoryUsage())
+        total = sum(by_object.values())
+        self.assertEqual(sum(self.ctx.memoryReport().values()), total)
+        by_type = self.ctx.memoryReport(group_by="attribute_type")
+        self.assertEqual(sum(by_type.values()), total)
+        self.assertIn("FloatVector", by_type)
+
+    def test_bad_group_raises(self):
+        with self.assertRaises(ValueError):
+            self.ctx.memoryReport(group_by="layer")
+
+
+if __name__ == "__main__":
+    unittest.main()
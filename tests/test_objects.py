@@ -5,7 +5,7 @@
 
 import unittest
 
-from .helpers import rdl2, _WithDsos, _first_class_name
+from .helpers import rdl2, np, _WithDsos, _first_class_name
 
 
 class TestDisplayFilter(_WithDsos):
@@ -199,6 +199,38 @@ class TestTraceSet(_WithDsos):
         box = self.ctx.createSceneObject("BoxGeometry", "/test/traceset/box")
         self.assertIsNone(box.asTraceSet())
 
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_assign_many_returns_int32_ids(self):
+        ts = self.ctx.createSceneObject("TraceSet", "/test/traceset/ts_many").asTraceSet()
+        ids = ts.assignMany([self.geo1, self.geo1, self.geo2], ["a", "b", "a"])
+        self.assertEqual(ids.dtype, np.int32)
+        self.assertEqual(ts.getAssignmentCount(), 3)
+        self.assertEqual(ids[1], ts.getAssignmentId(self.geo1, "b"))
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_assign_many_single_geometry(self):
+        ts = self.ctx.createSceneObject("TraceSet", "/test/traceset/ts_many1").asTraceSet()
+        ids = ts.assignMany(self.geo1, ["p0", "p1", "p2"])
+        self.assertEqual(len(ids), 3)
+        self.assertEqual(sorted(ts.getAssignmentIds(self.geo1)), sorted(ids.tolist()))
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_assign_many_length_mismatch_raises(self):
+        ts = self.ctx.createSceneObject("TraceSet", "/test/traceset/ts_many2").asTraceSet()
+        with self.assertRaises(ValueError):
+            ts.assignMany([self.geo1], ["a", "b"])
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_lookup_many_round_trip(self):
+        ts = self.ctx.createSceneObject("TraceSet", "/test/traceset/ts_many3").asTraceSet()
+        ids = ts.assignMany([self.geo1, self.geo2, self.geo1], ["x", "y", "z"])
+        geoms, index, parts = ts.lookupMany(ids)
+        self.assertEqual(len(geoms), 2)
+        self.assertEqual(index.dtype, np.int32)
+        self.assertEqual(index.tolist(), [0, 1, 0])
+        self.assertEqual(parts, ["x", "y", "z"])
+        self.assertEqual(geoms[0].getName(), self.geo1.getName())
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for the profiling submodule: opt-in per-binding counters."""
+
+import json
+import threading
+import unittest
+
+from .helpers import rdl2, _make_ctx
+
+prof = rdl2.profiling
+
+
+class TestProfiling(unittest.TestCase):
+    def setUp(self):
+        self.ctx = _make_ctx()
+        self.sv = self.ctx.getSceneVariables()
+        prof.disable()
+        prof.reset()
+
+    def tearDown(self):
+        prof.disable()
+        prof.reset()
+
+    def test_disabled_by_default_records_nothing(self):
+        self.assertFalse(prof.isEnabled())
+        self.sv["image_width"]
+        self.assertEqual(prof.getStats(), {})
+
+    def test_counts_getitem_and_setitem(self):
+        prof.enable()
+        for _ in range(3):
+            self.sv["image_width"]
+        self.sv["image_width"] = 640
+        stats = prof.getStats()
+        self.assertEqual(stats["SceneObject.__getitem__"]["calls"], 3)
+        self.assertEqual(stats["SceneObject.__setitem__"]["calls"], 1)
+        self.assertGreater(stats["SceneObject.__getitem__"]["bytes"], 0)
+        self.assertGreaterEqual(stats["SceneObject.__getitem__"]["time_s"], 0.0)
+        self.assertIn("UpdateScope", stats)
+
+    def test_counts_writer_calls_and_bytes(self):
+        prof.enable()
+        manifest, payload = rdl2.BinaryWriter(self.ctx).toBytes()
+        entry = prof.getStats()["BinaryWriter.toBytes"]
+        self.assertEqual(entry["calls"], 1)
+        self.assertEqual(entry["bytes"], len(manifest) + len(payload))
+
+    def test_sums_across_threads(self):
+        prof.enable()
+        threads = [threading.Thread(target=lambda: self.sv["frame"]) for _ in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(prof.getStats()["SceneObject.__getitem__"]["calls"], 4)
+
+    def test_reset(self):
+        prof.enable()
+        self.sv["frame"]
+        prof.reset()
+        self.assertEqual(prof.getStats(), {})
+
+    def test_disable_stops_recording(self):
+        prof.enable()
+        self.sv["frame"]
+        prof.disable()
+        self.sv["frame"]
+        self.assertEqual(prof.getStats()["SceneObject.__getitem__"]["calls"], 1)
+
+    def test_report_formats(self):
+        prof.enable()
+        self.sv["frame"]
+        table = prof.report()
+        self.assertIn("SceneObject.__getitem__", table)
+        data = json.loads(prof.report("json"))
+        self.assertEqual(data["SceneObject.__getitem__"]["calls"], 1)
+        with self.assertRaises(ValueError):
+            prof.report("xml")
+
+
+if __name__ == "__main__":
+    unittest.main()
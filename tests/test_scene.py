@@ -4,9 +4,10 @@
 """Tests for core scene types: SceneContext, SceneClass, Attribute, SceneObject,
 SceneVariables, Node/Camera/Geometry, and the type hierarchy."""
 
+import threading
 import unittest
 
-from .helpers import rdl2, DSO_PATH, _make_ctx, _first_class_name, _WithDsos
+from .helpers import rdl2, np, DSO_PATH, _make_ctx, _first_class_name, _WithDsos
 
 
 class TestSceneContext(unittest.TestCase):
@@ -384,6 +385,229 @@ class TestSceneObject(_WithDsos):
             _ = self.sv["this_attr_does_not_exist"]
 
 
+class TestAttributeHandle(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.sv = cls.ctx.getSceneVariables()
+        cls.frame = rdl2.AttributeHandle(cls.sv.getSceneClass(), "frame")
+
+    def test_repr_and_accessors(self):
+        self.assertIn("frame", repr(self.frame))
+        self.assertEqual(self.frame.getName(), "frame")
+        self.assertEqual(self.frame.getType(), rdl2.TYPE_FLOAT)
+        self.assertEqual(self.frame.getSceneClass().getName(), "SceneVariables")
+
+    def test_get_set_matches_getitem(self):
+        orig = self.sv["frame"]
+        self.frame.set(self.sv, 12.5)
+        self.assertAlmostEqual(self.sv["frame"], 12.5)
+        self.sv["frame"] = 3.0
+        self.assertAlmostEqual(self.frame.get(self.sv), 3.0)
+        self.sv["frame"] = orig
+
+    def test_timestep(self):
+        orig = self.sv["frame"]
+        self.frame.set(self.sv, 7.0, rdl2.TIMESTEP_BEGIN)
+        self.assertAlmostEqual(self.frame.get(self.sv, rdl2.TIMESTEP_BEGIN), 7.0)
+        self.sv["frame"] = orig
+
+    def test_wrong_class_raises(self):
+        box = self.ctx.createSceneObject("BoxGeometry", "/test/handle/box")
+        with self.assertRaises(TypeError):
+            self.frame.get(box)
+
+    def test_unknown_attr_raises(self):
+        with self.assertRaises(Exception):
+            rdl2.AttributeHandle(self.sv.getSceneClass(), "this_attr_does_not_exist")
+
+
+class TestIterSceneObjects(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = _make_ctx(load_dsos=True)
+        for i in range(3):
+            cls.ctx.createSceneObject("BoxGeometry", f"/iter/geo/box{i}")
+        cls.ctx.createSceneObject("GeometrySet", "/iter/sets/gs")
+
+    def _names(self, **filters):
+        return sorted(o.getName() for o in self.ctx.iterSceneObjects(**filters))
+
+    def test_no_filter_matches_get_all(self):
+        self.assertEqual(self._names(),
+                         sorted(o.getName() for o in self.ctx.getAllSceneObjects()))
+
+    def test_interface_filter(self):
+        self.assertEqual(self._names(interface=rdl2.INTERFACE_GEOMETRY),
+                         [f"/iter/geo/box{i}" for i in range(3)])
+
+    def test_class_name_filter(self):
+        self.assertEqual(self._names(class_name="GeometrySet"), ["/iter/sets/gs"])
+        self.assertEqual(self._names(class_name="NoSuchClass"), [])
+
+    def test_name_glob_filter(self):
+        self.assertEqual(self._names(name_glob="/iter/geo/box[02]"),
+                         ["/iter/geo/box0", "/iter/geo/box2"])
+
+    def test_combined_filters(self):
+        self.assertEqual(self._names(class_name="BoxGeometry",
+                                     interface=rdl2.INTERFACE_LIGHT), [])
+
+    def test_index_sees_new_objects(self):
+        before = len(self._names(interface=rdl2.INTERFACE_GEOMETRY))
+        self.ctx.createSceneObject("BoxGeometry", "/iter/geo/late")
+        self.assertEqual(len(self._names(interface=rdl2.INTERFACE_GEOMETRY)), before + 1)
+
+    def test_index_sees_loaded_objects(self):
+        rdl2.AsciiReader(self.ctx).fromString('BoxGeometry("/iter/loaded") {}')
+        self.assertIn("/iter/loaded", self._names(name_glob="/iter/loaded"))
+
+
+class TestUpdateBlock(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.sv = cls.ctx.getSceneVariables()
+
+    def test_update_block_sets_values(self):
+        orig = self.sv["frame"], self.sv["image_width"]
+        with self.sv.update() as block:
+            self.assertTrue(block.isActive())
+            self.sv["frame"] = 10.0
+            self.sv["image_width"] = 640
+        self.assertFalse(block.isActive())
+        self.assertAlmostEqual(self.sv["frame"], 10.0)
+        self.assertEqual(self.sv["image_width"], 640)
+        self.sv["frame"], self.sv["image_width"] = orig
+
+    def test_nested_blocks(self):
+        with self.sv.update():
+            with self.sv.update():
+                self.sv["frame"] = 4.0
+            self.sv["frame"] = 5.0
+        self.assertAlmostEqual(self.sv["frame"], 5.0)
+
+    def test_exception_closes_block(self):
+        with self.assertRaises(Exception):
+            with self.sv.update():
+                self.sv["this_attr_does_not_exist"] = 1
+        self.sv["frame"] = 6.0
+        self.assertAlmostEqual(self.sv["frame"], 6.0)
+
+    def test_batch_update(self):
+        geos = [self.ctx.createSceneObject("GeometrySet", f"/test/batch/gs{i}")
+                for i in range(3)]
+        with self.ctx.batchUpdate(geos) as block:
+            self.assertEqual(len(block.getObjects()), 3)
+            for gs in geos:
+                gs.asGeometrySet().clear()
+        self.assertFalse(block.isActive())
+
+    def test_exit_from_other_thread_raises(self):
+        block = self.sv.update()
+        block.__enter__()
+        errors = []
+
+        def leave():
+            try:
+                block.__exit__(None, None, None)
+            except RuntimeError as e:
+                errors.append(e)
+
+        worker = threading.Thread(target=leave)
+        worker.start()
+        worker.join()
+        self.assertEqual(len(errors), 1)
+        self.assertTrue(block.isActive())
+        block.__exit__(None, None, None)
+        self.assertFalse(block.isActive())
+
+    def test_dropped_block_is_closed(self):
+        block = self.sv.update()
+        block.__enter__()
+        del block
+        with self.sv.update() as again:
+            self.assertTrue(again.isActive())
+            self.sv["frame"] = 7.0
+        self.assertAlmostEqual(self.sv["frame"], 7.0)
+
+    def test_block_dropped_on_other_thread_is_released(self):
+        blocks = [self.sv.update()]
+        blocks[0].__enter__()
+        worker = threading.Thread(target=blocks.clear)
+        worker.start()
+        worker.join()
+        # Were sv still held for this thread, the setter would skip its own
+        # beginUpdate() and write to an object whose update has ended.
+        self.sv["frame"] = 8.0
+        self.assertAlmostEqual(self.sv["frame"], 8.0)
+        with self.sv.update() as again:
+            self.assertTrue(again.isActive())
+            self.sv["frame"] = 9.0
+        self.assertAlmostEqual(self.sv["frame"], 9.0)
+
+
+class TestBulkAttributeAccess(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        class_name = _first_class_name(cls.ctx, rdl2.INTERFACE_LIGHT)
+        if class_name is None:
+            raise unittest.SkipTest("No light classes available")
+        cls.light_class = class_name
+        cls.lights = [cls.ctx.createSceneObject(class_name, f"/test/bulk/light{i}")
+                      for i in range(8)]
+
+    def test_set_get_many_from_list(self):
+        self.ctx.setMany(self.lights, "intensity", [float(i) for i in range(8)])
+        for i, light in enumerate(self.lights):
+            self.assertAlmostEqual(light["intensity"], float(i))
+
+    def test_set_many_math_values(self):
+        colors = [rdl2.Rgb(0.1 * i, 0.0, 1.0) for i in range(8)]
+        self.ctx.setMany(self.lights, "color", colors)
+        self.assertAlmostEqual(self.lights[3]["color"].r, 0.3, places=5)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_get_many_returns_ndarray(self):
+        self.ctx.setMany(self.lights, "intensity", np.full(8, 2.5))
+        result = self.ctx.getMany(self.lights, "intensity")
+        self.assertEqual(result.shape, (8,))
+        np.testing.assert_allclose(result, 2.5)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_math_type_shape(self):
+        self.ctx.setMany(self.lights, "node_xform", np.tile(np.eye(4), (8, 1, 1)))
+        self.assertEqual(self.ctx.getMany(self.lights, "node_xform").shape, (8, 4, 4))
+
+    def test_non_numeric_returns_list(self):
+        self.ctx.setMany(self.lights, "label", [f"l{i}" for i in range(8)])
+        self.assertEqual(self.ctx.getMany(self.lights, "label"), [f"l{i}" for i in range(8)])
+
+    def test_length_mismatch_raises(self):
+        with self.assertRaises(ValueError):
+            self.ctx.setMany(self.lights, "intensity", [1.0, 2.0])
+
+    def test_empty_objects(self):
+        self.ctx.setMany([], "intensity", [])
+        self.assertEqual(self.ctx.getMany([], "label"), [])
+
+    def test_empty_objects_without_class_is_untyped(self):
+        self.assertEqual(self.ctx.getMany([], "intensity"), [])
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_empty_objects_typed_by_class_name(self):
+        cls = self.light_class
+        self.assertEqual(self.ctx.getMany([], "intensity", class_name=cls).shape, (0,))
+        self.assertEqual(self.ctx.getMany([], "node_xform", class_name=cls).shape, (0, 4, 4))
+
+    def test_empty_objects_unknown_name_raises(self):
+        with self.assertRaises(Exception) as nonempty:
+            self.ctx.getMany(self.lights, "no_such_attribute_xyz")
+        with self.assertRaises(type(nonempty.exception)):
+            self.ctx.getMany([], "no_such_attribute_xyz", class_name=self.light_class)
+
+
 class TestSceneVariables(_WithDsos):
     @classmethod
     def setUpClass(cls):
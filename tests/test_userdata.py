@@ -5,7 +5,7 @@
 
 import unittest
 
-from .helpers import rdl2, _WithDsos, _make_ctx
+from .helpers import rdl2, np, _WithDsos, _make_ctx
 
 
 class TestUserData(_WithDsos):
@@ -222,5 +222,52 @@ class TestUserData(_WithDsos):
         self.assertTrue(ud.hasMat4fData1())
 
 
+@unittest.skipIf(np is None, "NumPy is not installed")
+class TestUserDataArrays(_WithDsos):
+    def _new_ud(self, name):
+        return self.ctx.createSceneObject("UserData", f"/test/userdata/arr_{name}").asUserData()
+
+    def test_float_array_single(self):
+        ud = self._new_ud("f1")
+        ud.setFloatArray("f", np.array([1.0, 2.0, 3.0], dtype=np.float32))
+        self.assertEqual(ud.getFloatKey(), "f")
+        self.assertTrue(ud.hasFloatData0())
+        self.assertFalse(ud.hasFloatData1())
+        np.testing.assert_array_equal(ud.getFloatArray(), [1.0, 2.0, 3.0])
+
+    def test_vec3f_array_blur_pair(self):
+        ud = self._new_ud("v3")
+        p0 = np.arange(12, dtype=np.float32).reshape(4, 3)
+        ud.setVec3fArray("P", p0, p0 + 1.0)
+        self.assertTrue(ud.hasVec3fData1())
+        np.testing.assert_array_equal(ud.getVec3fArray(rdl2.TIMESTEP_BEGIN), p0)
+        np.testing.assert_array_equal(ud.getVec3fArray(rdl2.TIMESTEP_END), p0 + 1.0)
+        self.assertAlmostEqual(ud.getVec3fValues1()[1].x, 4.0)
+
+    def test_color_and_mat4f_shapes(self):
+        ud = self._new_ud("cm")
+        ud.setColorArray("Cd", np.ones((5, 3)))
+        self.assertEqual(ud.getColorArray().shape, (5, 3))
+        ud.setMat4fArray("xf", np.tile(np.eye(4, dtype=np.float32), (2, 1, 1)))
+        self.assertEqual(ud.getMat4fArray().shape, (2, 4, 4))
+
+    def test_view_is_read_only_copy_is_not(self):
+        ud = self._new_ud("ro")
+        ud.setVec2fArray("uv", np.zeros((3, 2), dtype=np.float32))
+        self.assertFalse(ud.getVec2fArray(copy=False).flags.writeable)
+        self.assertTrue(ud.getVec2fArray().flags.writeable)
+
+    def test_default_survives_later_set(self):
+        ud = self._new_ud("keep")
+        ud.setFloatArray("w", np.ones(3, dtype=np.float32))
+        arr = ud.getFloatArray()
+        ud.setFloatArray("w", np.zeros(1000, dtype=np.float32))
+        np.testing.assert_array_equal(arr, np.ones(3))
+
+    def test_wrong_shape_raises(self):
+        with self.assertRaises(ValueError):
+            self._new_ud("bad").setVec3fArray("P", np.zeros((4, 2), dtype=np.float32))
+
+
 if __name__ == "__main__":
     unittest.main()
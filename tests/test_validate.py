@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Alan Blevins
+# SPDX-License-Identifier: MIT
+"""Tests for validate(): built-in scene checks and the issue report."""
+
+import math
+import unittest
+
+from .helpers import rdl2, _first_class_name, _WithDsos
+
+
+class TestValidate(_WithDsos):
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.light_class = _first_class_name(cls.ctx, rdl2.INTERFACE_LIGHT)
+        cls.geo_class = _first_class_name(cls.ctx, rdl2.INTERFACE_GEOMETRY)
+
+    def setUp(self):
+        self.prefix = "/test/validate/" + self._testMethodName
+        self.light = self.ctx.createSceneObject(self.light_class, self.prefix + "/light")
+        self.geo = self.ctx.createSceneObject(self.geo_class, self.prefix + "/geo").asGeometry()
+        self.gset = self.ctx.createSceneObject("GeometrySet", self.prefix + "/gset")
+        self.gset.add(self.geo)
+
+    def _issues(self, rules, objects=None):
+        return rdl2.validate(self.ctx, rules, objects)
+
+    def test_returns_issue_list(self):
+        issues = rdl2.validate(self.ctx)
+        self.assertIsInstance(issues, list)
+        for issue in issues:
+            self.assertIsInstance(issue, rdl2.ValidationIssue)
+            self.assertIsInstance(issue.object, rdl2.SceneObject)
+
+    def test_non_finite(self):
+        self.light["intensity"] = math.nan
+        issues = self._issues(["non_finite"], [self.light])
+        self.assertEqual([(i.rule, i.attribute) for i in issues], [("non_finite", "intensity")])
+        self.assertEqual(issues[0].object.getName(), self.light.getName())
+
+    def test_finite_values_pass(self):
+        self.light["intensity"] = 1.0
+        self.assertEqual(self._issues(["non_finite"], [self.light]), [])
+
+    def test_empty_set(self):
+        empty = self.ctx.createSceneObject("GeometrySet", self.prefix + "/empty")
+        names = [i.object.getName() for i in self._issues(["empty_set"])]
+        self.assertIn(empty.getName(), names)
+        self.assertNotIn(self.gset.getName(), names)
+
+    def test_valid_membership_passes(self):
+        self.assertEqual(self._issues(["dangling_membership"], [self.gset]), [])
+
+    def test_rule_dict_filters_by_class(self):
+        self.light["intensity"] = math.inf
+        rule = {"kind": "non_finite", "class_name": "NoSuchClass"}
+        self.assertEqual(self._issues([rule], [self.light]), [])
+        rule = {"kind": "non_finite", "attributes": ["intensity"]}
+        self.assertEqual(len(self._issues([rule], [self.light])), 1)
+
+    def test_unbound_required(self):
+        bindable = [a.getName() for a in self.light.getSceneClass().getAttributes()
+                    if a.isBindable()]
+        if not bindable:
+            self.skipTest("light class has no bindable attributes")
+        rule = {"kind": "unbound_required", "attributes": bindable[:1]}
+        issues = self._issues([rule], [self.light])
+        self.assertEqual([i.attribute for i in issues], bindable[:1])
+
+    def test_unbound_required_needs_attributes(self):
+        with self.assertRaises(ValueError):
+            self._issues(["unbound_required"])
+
+    def test_unknown_rule_raises(self):
+        with self.assertRaises(ValueError):
+            self._issues(["no_such_rule"])
+
+
+if __name__ == "__main__":
+    unittest.main()